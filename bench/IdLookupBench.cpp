@@ -0,0 +1,69 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "com/IdLookup.h"
+#include <benchmark/benchmark.h>
+#include <array>
+
+namespace plug::bench
+{
+    namespace
+    {
+        constexpr std::array<std::uint8_t, 17> ampIds{{0x67, 0x64, 0x7c, 0x53, 0x6a, 0x75, 0x72, 0x61, 0x79,
+                                                       0x5e, 0x5d, 0x6d, 0xf1, 0xf6, 0xf9, 0xfc, 0xff}};
+        constexpr std::array<std::uint8_t, 38> effectIds{{0x00, 0x3c, 0x49, 0x4a, 0x1a, 0x1c, 0x88, 0x07, 0x12, 0x13,
+                                                          0x18, 0x19, 0x2d, 0x40, 0x41, 0x22, 0x29, 0x4f, 0x1f, 0x16,
+                                                          0x43, 0x48, 0x44, 0x45, 0x15, 0x46, 0x2b, 0x2a, 0x24, 0x3a,
+                                                          0x26, 0x3b, 0x4e, 0x4b, 0x4c, 0x4d, 0x21, 0x0b}};
+        constexpr std::array<std::uint8_t, 13> cabinetIds{{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+                                                           0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c}};
+
+
+        template <auto Lookup, const auto& ids>
+        void lookup(benchmark::State& state)
+        {
+            for ([[maybe_unused]] auto _ : state)
+            {
+                for (const auto id : ids)
+                {
+                    benchmark::DoNotOptimize(Lookup(id));
+                }
+            }
+            state.SetItemsProcessed(state.iterations() * ids.size());
+        }
+
+        void lookupAmp(benchmark::State& state)
+        {
+            lookup<lookupAmpById, ampIds>(state);
+        }
+        BENCHMARK(lookupAmp);
+
+        void lookupEffect(benchmark::State& state)
+        {
+            lookup<lookupEffectById, effectIds>(state);
+        }
+        BENCHMARK(lookupEffect);
+
+        void lookupCabinet(benchmark::State& state)
+        {
+            lookup<lookupCabinetById, cabinetIds>(state);
+        }
+        BENCHMARK(lookupCabinet);
+    }
+}
@@ -0,0 +1,109 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "ui/loadfromfile.h"
+#include <QTemporaryFile>
+#include <QXmlStreamWriter>
+#include <benchmark/benchmark.h>
+#include <array>
+#include <utility>
+
+namespace plug::bench
+{
+    namespace
+    {
+        void writeModule(QXmlStreamWriter& xml, int id, int position, int params)
+        {
+            xml.writeStartElement("Module");
+            xml.writeAttribute("ID", QString::number(id));
+            xml.writeAttribute("POS", QString::number(position));
+            xml.writeAttribute("BypassState", "1");
+
+            for (int i = 0; i < params; ++i)
+            {
+                xml.writeStartElement("Param");
+                xml.writeAttribute("ControlIndex", QString::number(i));
+                xml.writeCharacters(QString::number((i % 256) << 8));
+                xml.writeEndElement();
+            }
+            xml.writeEndElement();
+        }
+
+        // FUSE preset file with the amp module padded to the given number of parameters
+        void writeFuseFile(QFile& file, int ampParams)
+        {
+            QXmlStreamWriter xml{&file};
+            xml.setAutoFormatting(true);
+            xml.writeStartDocument();
+            xml.writeStartElement("Preset");
+            xml.writeAttribute("amplifier", "Mustang I/II");
+            xml.writeAttribute("ProductId", "1");
+
+            xml.writeStartElement("Amplifier");
+            writeModule(xml, 0x61, 0, ampParams);
+            xml.writeEndElement();
+
+            xml.writeStartElement("FX");
+            const std::array<std::pair<const char*, int>, 4> fx{{{"Stompbox", 0x3c}, {"Modulation", 0x19}, {"Delay", 0x2b}, {"Reverb", 0x3a}}};
+            for (std::size_t i = 0; i < fx.size(); ++i)
+            {
+                xml.writeStartElement(fx[i].first);
+                xml.writeAttribute("ID", QString::number(static_cast<int>(i) + 1));
+                writeModule(xml, fx[i].second, static_cast<int>(i), 6);
+                xml.writeEndElement();
+            }
+            xml.writeEndElement();
+
+            xml.writeStartElement("FUSE");
+            xml.writeStartElement("Info");
+            xml.writeAttribute("name", "Benchmark");
+            xml.writeCharacters("");
+            xml.writeEndElement();
+            xml.writeEndElement();
+
+            xml.writeTextElement("UsbGain", "17");
+
+            xml.writeEndElement();
+            xml.writeEndDocument();
+            file.flush();
+        }
+
+
+        void loadFile(benchmark::State& state)
+        {
+            QTemporaryFile file;
+
+            if (!file.open())
+            {
+                state.SkipWithError("Could not create file");
+                return;
+            }
+            writeFuseFile(file, static_cast<int>(state.range(0)));
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                file.seek(0);
+                LoadFromFile loader{&file};
+                benchmark::DoNotOptimize(loader.loadfile());
+            }
+            state.SetBytesProcessed(state.iterations() * file.size());
+        }
+        BENCHMARK(loadFile)->RangeMultiplier(8)->Range(24, 24 * 512);
+    }
+}
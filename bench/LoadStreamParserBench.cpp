@@ -0,0 +1,73 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "com/LoadStreamParser.h"
+#include "com/PacketSerializer.h"
+#include <string>
+#include <variant>
+#include <vector>
+#include <benchmark/benchmark.h>
+
+namespace plug::bench
+{
+    namespace
+    {
+        using namespace plug::com;
+
+        // Preset list part of the load stream, a name and a confirmation per preset
+        std::vector<PacketRawType> presetListStream(std::size_t numberOfPackets)
+        {
+            std::vector<PacketRawType> packets;
+            packets.reserve(numberOfPackets);
+
+            for (std::size_t i = 0; i < numberOfPackets / 2; ++i)
+            {
+                const auto slot = static_cast<std::uint8_t>(i);
+                auto name = serializeName(slot, "Preset " + std::to_string(i)).getBytes();
+                name[2] = 0x04;
+                name[3] = 0x00;
+                name[4] = slot;
+                packets.push_back(name);
+                packets.push_back(PacketRawType{{0x1c, 0x01, 0x00, 0x00, slot}});
+            }
+            return packets;
+        }
+
+
+        void parsePresetList(benchmark::State& state)
+        {
+            const auto packets = presetListStream(static_cast<std::size_t>(state.range(0)));
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                std::size_t names{0};
+                LoadStreamParser parser{LoadStreamParser::Stream::load, [&names](const load::Event& event)
+                                        { names += std::holds_alternative<load::PresetName>(event) ? 1 : 0; }};
+
+                for (const auto& packet : packets)
+                {
+                    parser.push(packet);
+                }
+                benchmark::DoNotOptimize(names);
+            }
+            state.SetItemsProcessed(state.iterations() * state.range(0) / 2);
+        }
+        BENCHMARK(parsePresetList)->Arg(48)->Arg(200);
+    }
+}
@@ -0,0 +1,93 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "MustangEmulator.h"
+#include "com/Mustang.h"
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <memory>
+
+namespace plug::bench
+{
+    namespace
+    {
+        using plug::test::emulator::MustangEmulator;
+
+        const DeviceModel emulatedModel{"Mustang III/IV/V", DeviceModel::Category::MustangV1, 100, 4, 4};
+
+
+        // Runs the operation end to end against an initialized emulator, which
+        // delays every transfer by state.range(0) us
+        template <class Operation>
+        void runOnEmulator(benchmark::State& state, Operation operation)
+        {
+            auto emulator = std::make_shared<MustangEmulator>(emulatedModel, std::chrono::microseconds{state.range(0)});
+            com::Mustang mustang{emulatedModel, emulator};
+            mustang.start_amp();
+            const auto transfersBefore = emulator->outTransfers() + emulator->inTransfers();
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                operation(mustang);
+            }
+
+            const auto transfers = emulator->outTransfers() + emulator->inTransfers() - transfersBefore;
+            state.counters["transfers"] = benchmark::Counter(static_cast<double>(transfers), benchmark::Counter::kAvgIterations);
+        }
+
+        void startAmp(benchmark::State& state)
+        {
+            runOnEmulator(state, [](com::Mustang& mustang)
+                          { benchmark::DoNotOptimize(mustang.start_amp()); });
+        }
+        BENCHMARK(startAmp)->Arg(0)->Arg(100)->UseRealTime();
+
+        void setAmplifier(benchmark::State& state)
+        {
+            constexpr amp_settings amp{amps::BRITISH_80S, 0x80, 0x80, 0x80, 0x80, 0x80, cabinets::cab4x12M, 0x01, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x01, false, 0x00};
+
+            runOnEmulator(state, [&amp](com::Mustang& mustang)
+                          { mustang.set_amplifier(amp); });
+        }
+        BENCHMARK(setAmplifier)->Arg(0)->Arg(100)->UseRealTime();
+
+        void setEffect(benchmark::State& state)
+        {
+            constexpr fx_pedal_settings effect{FxSlot{0}, effects::OVERDRIVE, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00};
+
+            runOnEmulator(state, [&effect](com::Mustang& mustang)
+                          { mustang.set_effect(effect); });
+        }
+        BENCHMARK(setEffect)->Arg(0)->Arg(100)->UseRealTime();
+
+        void loadMemoryBank(benchmark::State& state)
+        {
+            runOnEmulator(state, [](com::Mustang& mustang)
+                          { benchmark::DoNotOptimize(mustang.load_memory_bank(1)); });
+        }
+        BENCHMARK(loadMemoryBank)->Arg(0)->Arg(100)->UseRealTime();
+
+        void saveOnAmp(benchmark::State& state)
+        {
+            runOnEmulator(state, [](com::Mustang& mustang)
+                          { mustang.save_on_amp("benchmark", 2); });
+        }
+        BENCHMARK(saveOnAmp)->Arg(0)->Arg(100)->UseRealTime();
+    }
+}
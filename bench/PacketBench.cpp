@@ -0,0 +1,72 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "com/Packet.h"
+#include "com/PacketSerializer.h"
+#include <benchmark/benchmark.h>
+
+namespace plug::bench
+{
+    namespace
+    {
+        using namespace plug::com;
+
+        PacketRawType rawPacket()
+        {
+            PacketRawType data{};
+
+            for (std::size_t i = 0; i < data.size(); ++i)
+            {
+                data[i] = static_cast<std::uint8_t>(i);
+            }
+            return data;
+        }
+
+
+        template <class Payload>
+        void packetFromBytes(benchmark::State& state)
+        {
+            const auto data = rawPacket();
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                Packet<Payload> packet{};
+                packet.fromBytes(data);
+                benchmark::DoNotOptimize(packet);
+            }
+        }
+        BENCHMARK_TEMPLATE(packetFromBytes, AmpPayload);
+        BENCHMARK_TEMPLATE(packetFromBytes, EffectPayload);
+        BENCHMARK_TEMPLATE(packetFromBytes, NamePayload);
+
+        template <class Payload>
+        void packetGetBytes(benchmark::State& state)
+        {
+            const auto packet = fromRawData<Payload>(rawPacket());
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                benchmark::DoNotOptimize(packet.getBytes());
+            }
+        }
+        BENCHMARK_TEMPLATE(packetGetBytes, AmpPayload);
+        BENCHMARK_TEMPLATE(packetGetBytes, EffectPayload);
+        BENCHMARK_TEMPLATE(packetGetBytes, NamePayload);
+    }
+}
@@ -0,0 +1,69 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "com/PacketSerializer.h"
+#include <benchmark/benchmark.h>
+
+namespace plug::bench
+{
+    namespace
+    {
+        using namespace plug::com;
+
+        constexpr amp_settings amp{amps::BRITISH_60S, 4, 8, 5, 9, 1,
+                                   cabinets::cabBSSMN, 5, 3, 4, 7, 4, 2, 6, 1,
+                                   true, 17};
+
+
+        void serializeAmp(benchmark::State& state)
+        {
+            for ([[maybe_unused]] auto _ : state)
+            {
+                benchmark::DoNotOptimize(serializeAmpSettings(amp));
+            }
+        }
+        BENCHMARK(serializeAmp);
+
+        void decodeAmp(benchmark::State& state)
+        {
+            const auto packet = serializeAmpSettings(amp);
+            const auto packetUsbGain = serializeAmpSettingsUsbGain(amp);
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                benchmark::DoNotOptimize(decodeAmpFromData(packet, packetUsbGain));
+            }
+        }
+        BENCHMARK(decodeAmp);
+
+        void decodeEffects(benchmark::State& state)
+        {
+            const std::array<Packet<EffectPayload>, 4> packets{{serializeEffectSettings({FxSlot{0}, effects::OVERDRIVE, 1, 2, 3, 4, 5, 0}),
+                                                                serializeEffectSettings({FxSlot{1}, effects::TRIANGLE_FLANGER, 10, 20, 30, 40, 50, 0}),
+                                                                serializeEffectSettings({FxSlot{2}, effects::TAPE_DELAY, 1, 2, 3, 4, 5, 6}),
+                                                                serializeEffectSettings({FxSlot{3}, effects::LARGE_HALL_REVERB, 6, 5, 4, 3, 2, 0})}};
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                benchmark::DoNotOptimize(decodeEffectsFromData(packets));
+            }
+        }
+        BENCHMARK(decodeEffects);
+    }
+}
@@ -34,8 +34,11 @@ namespace plug
             Other
         };
 
-        DeviceModel(const std::string& name, Category category, std::size_t numberPresets)
-            : name_(name), category_(category), numberPresets_(numberPresets)
+        // Each number is 0 if it's unknown for the model
+        DeviceModel(const std::string& name, Category category, std::size_t numberPresets,
+                    std::size_t numberModPresets = 0, std::size_t numberDlyRevPresets = 0)
+            : name_(name), category_(category), numberPresets_(numberPresets),
+              numberModPresets_(numberModPresets), numberDlyRevPresets_(numberDlyRevPresets)
         {
         }
 
@@ -51,10 +54,20 @@ namespace plug
         {
             return numberPresets_;
         }
+        std::size_t numberOfModPresets() const
+        {
+            return numberModPresets_;
+        }
+        std::size_t numberOfDlyRevPresets() const
+        {
+            return numberDlyRevPresets_;
+        }
 
     private:
         std::string name_;
         Category category_;
         std::size_t numberPresets_;
+        std::size_t numberModPresets_;
+        std::size_t numberDlyRevPresets_;
     };
 }
@@ -0,0 +1,395 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "effects_enum.h"
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+// Same as Qt's, so that lupdate finds the knob texts without Qt being included here
+#ifndef QT_TRANSLATE_NOOP
+#define QT_TRANSLATE_NOOP(scope, x) x
+#endif
+
+namespace plug
+{
+
+    // The DSP an effect runs on
+    enum class EffectFamily
+    {
+        none,
+        stomp,
+        modulation,
+        delay,
+        reverb
+    };
+
+    // Label and name are marked for translation in the "EffectModel" context
+    struct KnobInfo
+    {
+        const char* label; // Widget label, '&' marks the shortcut
+        const char* name;
+        std::uint8_t max;  // 0 if the effect doesn't use the knob
+    };
+
+    struct EffectModel
+    {
+        effects model;
+        std::uint8_t id;
+        std::array<std::uint8_t, 3> unknown; // Effect payload bytes 3 - 5
+        EffectFamily family;
+        std::string_view name;
+        std::array<KnobInfo, 6> knobs;
+        std::array<std::uint8_t, 6> defaults;
+
+        constexpr std::size_t knobCount() const
+        {
+            std::size_t count{0};
+
+            for (const auto& knob : knobs)
+            {
+                if (knob.max > 0)
+                {
+                    ++count;
+                }
+            }
+            return count;
+        }
+    };
+
+
+    // Ordered by enum value, so the model is also the index
+    inline constexpr std::array<EffectModel, 38> effectModels{{
+        {effects::EMPTY, 0x00, {0x00, 0x08, 0x01}, EffectFamily::none, "EMPTY",
+         {{{}, {}, {}, {}, {}, {}}},
+         {0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},
+        {effects::OVERDRIVE, 0x3c, {0x00, 0x08, 0x01}, EffectFamily::stomp, "Overdrive",
+         {{{QT_TRANSLATE_NOOP("EffectModel", "&Level"), QT_TRANSLATE_NOOP("EffectModel", "Level"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Gain"), QT_TRANSLATE_NOOP("EffectModel", "Gain"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "L&ow"), QT_TRANSLATE_NOOP("EffectModel", "Low tones"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Medium"), QT_TRANSLATE_NOOP("EffectModel", "Medium tones"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&High"), QT_TRANSLATE_NOOP("EffectModel", "High tones"), 0xff},
+           {}}},
+         {0x80, 0x80, 0x80, 0x80, 0x80, 0x00}},
+        {effects::WAH, 0x49, {0x01, 0x08, 0x01}, EffectFamily::stomp, "Wah",
+         {{{QT_TRANSLATE_NOOP("EffectModel", "&Mix"), QT_TRANSLATE_NOOP("EffectModel", "Mix"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Frequency"), QT_TRANSLATE_NOOP("EffectModel", "Frequency"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Heel Freq"), QT_TRANSLATE_NOOP("EffectModel", "Heel Frequency"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Toe Freq"), QT_TRANSLATE_NOOP("EffectModel", "Toe Frequency"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "High &Q"), QT_TRANSLATE_NOOP("EffectModel", "High Q"), 0xff},
+           {}}},
+         {0xff, 0x80, 0x00, 0xff, 0x00, 0x00}},
+        {effects::TOUCH_WAH, 0x4a, {0x01, 0x08, 0x01}, EffectFamily::stomp, "Touch Wah",
+         {{{QT_TRANSLATE_NOOP("EffectModel", "&Mix"), QT_TRANSLATE_NOOP("EffectModel", "Mix"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Sensivity"), QT_TRANSLATE_NOOP("EffectModel", "Sensivity"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Heel Freq"), QT_TRANSLATE_NOOP("EffectModel", "Heel Frequency"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Toe Freq"), QT_TRANSLATE_NOOP("EffectModel", "Toe Frequency"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "High &Q"), QT_TRANSLATE_NOOP("EffectModel", "High Q"), 0xff},
+           {}}},
+         {0xff, 0x80, 0x00, 0xff, 0x00, 0x00}},
+        {effects::FUZZ, 0x1a, {0x00, 0x08, 0x01}, EffectFamily::stomp, "Fuzz",
+         {{{QT_TRANSLATE_NOOP("EffectModel", "&Level"), QT_TRANSLATE_NOOP("EffectModel", "Level"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Gain"), QT_TRANSLATE_NOOP("EffectModel", "Gain"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Octave"), QT_TRANSLATE_NOOP("EffectModel", "Octave"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "L&ow"), QT_TRANSLATE_NOOP("EffectModel", "Low tones"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&High"), QT_TRANSLATE_NOOP("EffectModel", "High tones"), 0xff},
+           {}}},
+         {0x80, 0x80, 0x80, 0x80, 0x80, 0x00}},
+        {effects::FUZZ_TOUCH_WAH, 0x1c, {0x00, 0x08, 0x01}, EffectFamily::stomp, "Fuzz Touch Wah",
+         {{{QT_TRANSLATE_NOOP("EffectModel", "&Level"), QT_TRANSLATE_NOOP("EffectModel", "Level"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Gain"), QT_TRANSLATE_NOOP("EffectModel", "Gain"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Sensivity"), QT_TRANSLATE_NOOP("EffectModel", "Sensivity"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Octave"), QT_TRANSLATE_NOOP("EffectModel", "Octave"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Peak"), QT_TRANSLATE_NOOP("EffectModel", "Peak"), 0xff},
+           {}}},
+         {0x80, 0x80, 0x80, 0x80, 0x80, 0x00}},
+        {effects::SIMPLE_COMP, 0x88, {0x08, 0x08, 0x01}, EffectFamily::stomp, "Simple Compressor",
+         {{{QT_TRANSLATE_NOOP("EffectModel", "&Type"), QT_TRANSLATE_NOOP("EffectModel", "Type"), 0x03},
+           {},
+           {},
+           {},
+           {},
+           {}}},
+         {0x01, 0x00, 0x00, 0x00, 0x00, 0x00}},
+        {effects::COMPRESSOR, 0x07, {0x00, 0x08, 0x01}, EffectFamily::stomp, "Compressor",
+         {{{QT_TRANSLATE_NOOP("EffectModel", "&Level"), QT_TRANSLATE_NOOP("EffectModel", "Level"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Threshold"), QT_TRANSLATE_NOOP("EffectModel", "Threshold"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Ratio"), QT_TRANSLATE_NOOP("EffectModel", "Ratio"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "Atta&ck"), QT_TRANSLATE_NOOP("EffectModel", "Attack"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Release"), QT_TRANSLATE_NOOP("EffectModel", "Release"), 0xff},
+           {}}},
+         {0x8d, 0x0f, 0x4f, 0x7f, 0x7f, 0x00}},
+        {effects::SINE_CHORUS, 0x12, {0x01, 0x01, 0x01}, EffectFamily::modulation, "Sine Chorus",
+         {{{QT_TRANSLATE_NOOP("EffectModel", "&Level"), QT_TRANSLATE_NOOP("EffectModel", "Level"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Rate"), QT_TRANSLATE_NOOP("EffectModel", "Rate"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Depth"), QT_TRANSLATE_NOOP("EffectModel", "Depth"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "A&vr Delay"), QT_TRANSLATE_NOOP("EffectModel", "Average Delay"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "LR &Phase"), QT_TRANSLATE_NOOP("EffectModel", "LR Phase"), 0xff},
+           {}}},
+         {0xff, 0x0e, 0x19, 0x19, 0x80, 0x00}},
+        {effects::TRIANGLE_CHORUS, 0x13, {0x01, 0x01, 0x01}, EffectFamily::modulation, "Triangle Chorus",
+         {{{QT_TRANSLATE_NOOP("EffectModel", "&Level"), QT_TRANSLATE_NOOP("EffectModel", "Level"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Rate"), QT_TRANSLATE_NOOP("EffectModel", "Rate"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Depth"), QT_TRANSLATE_NOOP("EffectModel", "Depth"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "A&vr Delay"), QT_TRANSLATE_NOOP("EffectModel", "Average Delay"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "LR &Phase"), QT_TRANSLATE_NOOP("EffectModel", "LR Phase"), 0xff},
+           {}}},
+         {0x5d, 0x0e, 0x19, 0x19, 0x80, 0x00}},
+        {effects::SINE_FLANGER, 0x18, {0x01, 0x01, 0x01}, EffectFamily::modulation, "Sine Flanger",
+         {{{QT_TRANSLATE_NOOP("EffectModel", "&Level"), QT_TRANSLATE_NOOP("EffectModel", "Level"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Rate"), QT_TRANSLATE_NOOP("EffectModel", "Rate"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Depth"), QT_TRANSLATE_NOOP("EffectModel", "Depth"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Feedback"), QT_TRANSLATE_NOOP("EffectModel", "Feedback"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "LR &Phase"), QT_TRANSLATE_NOOP("EffectModel", "LR Phase"), 0xff},
+           {}}},
+         {0xff, 0x0e, 0x80, 0x80, 0x80, 0x00}},
+        {effects::TRIANGLE_FLANGER, 0x19, {0x01, 0x01, 0x01}, EffectFamily::modulation, "Triangle Flanger",
+         {{{QT_TRANSLATE_NOOP("EffectModel", "&Level"), QT_TRANSLATE_NOOP("EffectModel", "Level"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Rate"), QT_TRANSLATE_NOOP("EffectModel", "Rate"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Depth"), QT_TRANSLATE_NOOP("EffectModel", "Depth"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Feedback"), QT_TRANSLATE_NOOP("EffectModel", "Feedback"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "LR &Phase"), QT_TRANSLATE_NOOP("EffectModel", "LR Phase"), 0xff},
+           {}}},
+         {0xff, 0x00, 0xff, 0x33, 0x41, 0x00}},
+        {effects::VIBRATONE, 0x2d, {0x01, 0x01, 0x01}, EffectFamily::modulation, "Vibratone",
+         {{{QT_TRANSLATE_NOOP("EffectModel", "&Level"), QT_TRANSLATE_NOOP("EffectModel", "Level"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Rotor"), QT_TRANSLATE_NOOP("EffectModel", "Rotor"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Depth"), QT_TRANSLATE_NOOP("EffectModel", "Depth"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Feedback"), QT_TRANSLATE_NOOP("EffectModel", "Feedback"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "LR &Phase"), QT_TRANSLATE_NOOP("EffectModel", "LR Phase"), 0xff},
+           {}}},
+         {0xf4, 0xff, 0x27, 0xad, 0x82, 0x00}},
+        {effects::VINTAGE_TREMOLO, 0x40, {0x01, 0x01, 0x01}, EffectFamily::modulation, "Vintage Tremolo",
+         {{{QT_TRANSLATE_NOOP("EffectModel", "&Level"), QT_TRANSLATE_NOOP("EffectModel", "Level"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Rate"), QT_TRANSLATE_NOOP("EffectModel", "Rate"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Duty Cycle"), QT_TRANSLATE_NOOP("EffectModel", "Duty Cycle"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "Atta&ck"), QT_TRANSLATE_NOOP("EffectModel", "Attack"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "Relea&se"), QT_TRANSLATE_NOOP("EffectModel", "Release"), 0xff},
+           {}}},
+         {0xdb, 0xad, 0x63, 0xf4, 0xf1, 0x00}},
+        {effects::SINE_TREMOLO, 0x41, {0x01, 0x01, 0x01}, EffectFamily::modulation, "Sine Tremolo",
+         {{{QT_TRANSLATE_NOOP("EffectModel", "&Level"), QT_TRANSLATE_NOOP("EffectModel", "Level"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Rate"), QT_TRANSLATE_NOOP("EffectModel", "Rate"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Duty Cycle"), QT_TRANSLATE_NOOP("EffectModel", "Duty Cycle"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "LFO &Clipping"), QT_TRANSLATE_NOOP("EffectModel", "LFO Clipping"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Shape"), QT_TRANSLATE_NOOP("EffectModel", "Shape"), 0xff},
+           {}}},
+         {0xdb, 0x99, 0x7d, 0x00, 0x00, 0x00}},
+        {effects::RING_MODULATOR, 0x22, {0x01, 0x08, 0x01}, EffectFamily::modulation, "Ring Modulator",
+         {{{QT_TRANSLATE_NOOP("EffectModel", "&Level"), QT_TRANSLATE_NOOP("EffectModel", "Level"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Frequency"), QT_TRANSLATE_NOOP("EffectModel", "Frequency"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Depth"), QT_TRANSLATE_NOOP("EffectModel", "Depth"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Shape"), QT_TRANSLATE_NOOP("EffectModel", "Shape"), 0x01},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Phase"), QT_TRANSLATE_NOOP("EffectModel", "Phase"), 0xff},
+           {}}},
+         {0xff, 0x80, 0x80, 0x01, 0x80, 0x00}},
+        {effects::STEP_FILTER, 0x29, {0x01, 0x01, 0x01}, EffectFamily::modulation, "Step Filter",
+         {{{QT_TRANSLATE_NOOP("EffectModel", "&Level"), QT_TRANSLATE_NOOP("EffectModel", "Level"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Rate"), QT_TRANSLATE_NOOP("EffectModel", "Rate"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "Re&sonance"), QT_TRANSLATE_NOOP("EffectModel", "Resonance"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "Mi&n Freq"), QT_TRANSLATE_NOOP("EffectModel", "Minimum Frequency"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "Ma&x Freq"), QT_TRANSLATE_NOOP("EffectModel", "Maximum Frequency"), 0xff},
+           {}}},
+         {0xff, 0x80, 0x80, 0x80, 0x80, 0x00}},
+        {effects::PHASER, 0x4f, {0x01, 0x01, 0x01}, EffectFamily::modulation, "Phaser",
+         {{{QT_TRANSLATE_NOOP("EffectModel", "&Level"), QT_TRANSLATE_NOOP("EffectModel", "Level"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Rate"), QT_TRANSLATE_NOOP("EffectModel", "Rate"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Depth"), QT_TRANSLATE_NOOP("EffectModel", "Depth"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Feedback"), QT_TRANSLATE_NOOP("EffectModel", "Feedback"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Shape"), QT_TRANSLATE_NOOP("EffectModel", "Shape"), 0x01},
+           {}}},
+         {0xfd, 0x00, 0xfd, 0xb8, 0x00, 0x00}},
+        {effects::PITCH_SHIFTER, 0x1f, {0x01, 0x08, 0x01}, EffectFamily::modulation, "Pitch Shifter",
+         {{{QT_TRANSLATE_NOOP("EffectModel", "&Level"), QT_TRANSLATE_NOOP("EffectModel", "Level"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Pitch"), QT_TRANSLATE_NOOP("EffectModel", "Pitch"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Detune"), QT_TRANSLATE_NOOP("EffectModel", "Detune"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Feedback"), QT_TRANSLATE_NOOP("EffectModel", "Feedback"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "P&redelay"), QT_TRANSLATE_NOOP("EffectModel", "Predelay"), 0xff},
+           {}}},
+         {0xc7, 0x3e, 0x80, 0x00, 0x00, 0x00}},
+        {effects::MONO_DELAY, 0x16, {0x02, 0x01, 0x01}, EffectFamily::delay, "Mono Delay",
+         {{{QT_TRANSLATE_NOOP("EffectModel", "&Level"), QT_TRANSLATE_NOOP("EffectModel", "Level"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Delay"), QT_TRANSLATE_NOOP("EffectModel", "Delay"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Feedback"), QT_TRANSLATE_NOOP("EffectModel", "Feedback"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Brightness"), QT_TRANSLATE_NOOP("EffectModel", "Brightness"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "A&ttenuation"), QT_TRANSLATE_NOOP("EffectModel", "Attenuation"), 0xff},
+           {}}},
+         {0xff, 0x80, 0x80, 0x80, 0x80, 0x00}},
+        {effects::MONO_ECHO_FILTER, 0x43, {0x02, 0x01, 0x01}, EffectFamily::delay, "Mono Echo Filter",
+         {{{QT_TRANSLATE_NOOP("EffectModel", "&Level"), QT_TRANSLATE_NOOP("EffectModel", "Level"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Delay"), QT_TRANSLATE_NOOP("EffectModel", "Delay"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Feedback"), QT_TRANSLATE_NOOP("EffectModel", "Feedback"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "Fre&quency"), QT_TRANSLATE_NOOP("EffectModel", "Frequency"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Ressonance"), QT_TRANSLATE_NOOP("EffectModel", "Resonance"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&In Level"), QT_TRANSLATE_NOOP("EffectModel", "In Level"), 0xff}}},
+         {0xff, 0x80, 0x80, 0x80, 0x80, 0x80}},
+        {effects::STEREO_ECHO_FILTER, 0x48, {0x02, 0x01, 0x01}, EffectFamily::delay, "Stereo Echo Filter",
+         {{{QT_TRANSLATE_NOOP("EffectModel", "&Level"), QT_TRANSLATE_NOOP("EffectModel", "Level"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Delay"), QT_TRANSLATE_NOOP("EffectModel", "Delay"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Feedback"), QT_TRANSLATE_NOOP("EffectModel", "Feedback"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "Fre&quency"), QT_TRANSLATE_NOOP("EffectModel", "Frequency"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Ressonance"), QT_TRANSLATE_NOOP("EffectModel", "Resonance"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&In Level"), QT_TRANSLATE_NOOP("EffectModel", "In Level"), 0xff}}},
+         {0x80, 0xb3, 0x80, 0x80, 0x80, 0x80}},
+        {effects::MULTITAP_DELAY, 0x44, {0x02, 0x01, 0x01}, EffectFamily::delay, "Multitap Delay",
+         {{{QT_TRANSLATE_NOOP("EffectModel", "&Level"), QT_TRANSLATE_NOOP("EffectModel", "Level"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Delay"), QT_TRANSLATE_NOOP("EffectModel", "Delay"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Feedback"), QT_TRANSLATE_NOOP("EffectModel", "Feedback"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Brightness"), QT_TRANSLATE_NOOP("EffectModel", "Brightness"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Mode"), QT_TRANSLATE_NOOP("EffectModel", "Mode"), 0x03},
+           {}}},
+         {0xff, 0x80, 0x66, 0x80, 0x03, 0x00}},
+        {effects::PING_PONG_DELAY, 0x45, {0x02, 0x01, 0x01}, EffectFamily::delay, "Ping-Pong Delay",
+         {{{QT_TRANSLATE_NOOP("EffectModel", "&Level"), QT_TRANSLATE_NOOP("EffectModel", "Level"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Delay"), QT_TRANSLATE_NOOP("EffectModel", "Delay"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Feedback"), QT_TRANSLATE_NOOP("EffectModel", "Feedback"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Brightness"), QT_TRANSLATE_NOOP("EffectModel", "Brightness"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Stereo"), QT_TRANSLATE_NOOP("EffectModel", "Stereo"), 0xff},
+           {}}},
+         {0xff, 0x80, 0x80, 0x80, 0x80, 0x00}},
+        {effects::DUCKING_DELAY, 0x15, {0x02, 0x01, 0x01}, EffectFamily::delay, "Ducking Delay",
+         {{{QT_TRANSLATE_NOOP("EffectModel", "&Level"), QT_TRANSLATE_NOOP("EffectModel", "Level"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Delay"), QT_TRANSLATE_NOOP("EffectModel", "Delay"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Feedback"), QT_TRANSLATE_NOOP("EffectModel", "Feedback"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Release"), QT_TRANSLATE_NOOP("EffectModel", "Release"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Threshold"), QT_TRANSLATE_NOOP("EffectModel", "Threshold"), 0xff},
+           {}}},
+         {0xff, 0x80, 0x80, 0x80, 0x80, 0x00}},
+        {effects::REVERSE_DELAY, 0x46, {0x02, 0x01, 0x01}, EffectFamily::delay, "Reverse Delay",
+         {{{QT_TRANSLATE_NOOP("EffectModel", "&Level"), QT_TRANSLATE_NOOP("EffectModel", "Level"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Delay"), QT_TRANSLATE_NOOP("EffectModel", "Delay"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Feedback"), QT_TRANSLATE_NOOP("EffectModel", "Feedback"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&RFDBK"), QT_TRANSLATE_NOOP("EffectModel", "RFDBK"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Tone"), QT_TRANSLATE_NOOP("EffectModel", "Tone"), 0xff},
+           {}}},
+         {0xff, 0x80, 0x80, 0x80, 0x80, 0x00}},
+        {effects::TAPE_DELAY, 0x2b, {0x02, 0x01, 0x01}, EffectFamily::delay, "Tape Delay",
+         {{{QT_TRANSLATE_NOOP("EffectModel", "&Level"), QT_TRANSLATE_NOOP("EffectModel", "Level"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Delay"), QT_TRANSLATE_NOOP("EffectModel", "Delay"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Feedback"), QT_TRANSLATE_NOOP("EffectModel", "Feedback"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "Fl&utter"), QT_TRANSLATE_NOOP("EffectModel", "Flutter"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Brightness"), QT_TRANSLATE_NOOP("EffectModel", "Brightness"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Stereo"), QT_TRANSLATE_NOOP("EffectModel", "Stereo"), 0xff}}},
+         {0x7d, 0x1c, 0x00, 0x63, 0x80, 0x00}},
+        {effects::STEREO_TAPE_DELAY, 0x2a, {0x02, 0x01, 0x01}, EffectFamily::delay, "Stereo Tape Delay",
+         {{{QT_TRANSLATE_NOOP("EffectModel", "&Level"), QT_TRANSLATE_NOOP("EffectModel", "Level"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Delay"), QT_TRANSLATE_NOOP("EffectModel", "Delay"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Feedback"), QT_TRANSLATE_NOOP("EffectModel", "Feedback"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "Fl&utter"), QT_TRANSLATE_NOOP("EffectModel", "Flutter"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Separation"), QT_TRANSLATE_NOOP("EffectModel", "Separation"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Brightness"), QT_TRANSLATE_NOOP("EffectModel", "Brightness"), 0xff}}},
+         {0x7d, 0x88, 0x1c, 0x63, 0xff, 0x80}},
+        {effects::SMALL_HALL_REVERB, 0x24, {0x00, 0x08, 0x01}, EffectFamily::reverb, "Small Hall Reverb",
+         {{{QT_TRANSLATE_NOOP("EffectModel", "&Level"), QT_TRANSLATE_NOOP("EffectModel", "Level"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Decay"), QT_TRANSLATE_NOOP("EffectModel", "Decay"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "D&well"), QT_TRANSLATE_NOOP("EffectModel", "Dwell"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "D&iffusion"), QT_TRANSLATE_NOOP("EffectModel", "Diffusion"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Tone"), QT_TRANSLATE_NOOP("EffectModel", "Tone"), 0xff},
+           {}}},
+         {0x6e, 0x5d, 0x6e, 0x80, 0x91, 0x00}},
+        {effects::LARGE_HALL_REVERB, 0x3a, {0x00, 0x08, 0x01}, EffectFamily::reverb, "Large Hall Reverb",
+         {{{QT_TRANSLATE_NOOP("EffectModel", "&Level"), QT_TRANSLATE_NOOP("EffectModel", "Level"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Decay"), QT_TRANSLATE_NOOP("EffectModel", "Decay"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "D&well"), QT_TRANSLATE_NOOP("EffectModel", "Dwell"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "D&iffusion"), QT_TRANSLATE_NOOP("EffectModel", "Diffusion"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Tone"), QT_TRANSLATE_NOOP("EffectModel", "Tone"), 0xff},
+           {}}},
+         {0x4f, 0x3e, 0x80, 0x05, 0xb0, 0x00}},
+        {effects::SMALL_ROOM_REVERB, 0x26, {0x00, 0x08, 0x01}, EffectFamily::reverb, "Small Room Reverb",
+         {{{QT_TRANSLATE_NOOP("EffectModel", "&Level"), QT_TRANSLATE_NOOP("EffectModel", "Level"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Decay"), QT_TRANSLATE_NOOP("EffectModel", "Decay"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "D&well"), QT_TRANSLATE_NOOP("EffectModel", "Dwell"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "D&iffusion"), QT_TRANSLATE_NOOP("EffectModel", "Diffusion"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Tone"), QT_TRANSLATE_NOOP("EffectModel", "Tone"), 0xff},
+           {}}},
+         {0x80, 0x80, 0x80, 0x80, 0x80, 0x00}},
+        {effects::LARGE_ROOM_REVERB, 0x3b, {0x00, 0x08, 0x01}, EffectFamily::reverb, "Large Room Reverb",
+         {{{QT_TRANSLATE_NOOP("EffectModel", "&Level"), QT_TRANSLATE_NOOP("EffectModel", "Level"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Decay"), QT_TRANSLATE_NOOP("EffectModel", "Decay"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "D&well"), QT_TRANSLATE_NOOP("EffectModel", "Dwell"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "D&iffusion"), QT_TRANSLATE_NOOP("EffectModel", "Diffusion"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Tone"), QT_TRANSLATE_NOOP("EffectModel", "Tone"), 0xff},
+           {}}},
+         {0x80, 0x80, 0x80, 0x80, 0x80, 0x00}},
+        {effects::SMALL_PLATE_REVERB, 0x4e, {0x00, 0x08, 0x01}, EffectFamily::reverb, "Small Plate Reverb",
+         {{{QT_TRANSLATE_NOOP("EffectModel", "&Level"), QT_TRANSLATE_NOOP("EffectModel", "Level"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Decay"), QT_TRANSLATE_NOOP("EffectModel", "Decay"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "D&well"), QT_TRANSLATE_NOOP("EffectModel", "Dwell"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "D&iffusion"), QT_TRANSLATE_NOOP("EffectModel", "Diffusion"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Tone"), QT_TRANSLATE_NOOP("EffectModel", "Tone"), 0xff},
+           {}}},
+         {0x80, 0x80, 0x80, 0x80, 0x80, 0x00}},
+        {effects::LARGE_PLATE_REVERB, 0x4b, {0x00, 0x08, 0x01}, EffectFamily::reverb, "Large Plate Reverb",
+         {{{QT_TRANSLATE_NOOP("EffectModel", "&Level"), QT_TRANSLATE_NOOP("EffectModel", "Level"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Decay"), QT_TRANSLATE_NOOP("EffectModel", "Decay"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "D&well"), QT_TRANSLATE_NOOP("EffectModel", "Dwell"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "D&iffusion"), QT_TRANSLATE_NOOP("EffectModel", "Diffusion"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Tone"), QT_TRANSLATE_NOOP("EffectModel", "Tone"), 0xff},
+           {}}},
+         {0x38, 0x80, 0x91, 0x80, 0xb6, 0x00}},
+        {effects::AMBIENT_REVERB, 0x4c, {0x00, 0x08, 0x01}, EffectFamily::reverb, "Ambient Reverb",
+         {{{QT_TRANSLATE_NOOP("EffectModel", "&Level"), QT_TRANSLATE_NOOP("EffectModel", "Level"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Decay"), QT_TRANSLATE_NOOP("EffectModel", "Decay"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "D&well"), QT_TRANSLATE_NOOP("EffectModel", "Dwell"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "D&iffusion"), QT_TRANSLATE_NOOP("EffectModel", "Diffusion"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Tone"), QT_TRANSLATE_NOOP("EffectModel", "Tone"), 0xff},
+           {}}},
+         {0xff, 0x80, 0x80, 0x80, 0x80, 0x00}},
+        {effects::ARENA_REVERB, 0x4d, {0x00, 0x08, 0x01}, EffectFamily::reverb, "Arena Reverb",
+         {{{QT_TRANSLATE_NOOP("EffectModel", "&Level"), QT_TRANSLATE_NOOP("EffectModel", "Level"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Decay"), QT_TRANSLATE_NOOP("EffectModel", "Decay"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "D&well"), QT_TRANSLATE_NOOP("EffectModel", "Dwell"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "D&iffusion"), QT_TRANSLATE_NOOP("EffectModel", "Diffusion"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Tone"), QT_TRANSLATE_NOOP("EffectModel", "Tone"), 0xff},
+           {}}},
+         {0xff, 0x80, 0x80, 0x80, 0x80, 0x00}},
+        {effects::FENDER_63_SPRING_REVERB, 0x21, {0x00, 0x08, 0x01}, EffectFamily::reverb, "Fender '63 Spring Reverb",
+         {{{QT_TRANSLATE_NOOP("EffectModel", "&Level"), QT_TRANSLATE_NOOP("EffectModel", "Level"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Decay"), QT_TRANSLATE_NOOP("EffectModel", "Decay"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "D&well"), QT_TRANSLATE_NOOP("EffectModel", "Dwell"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "D&iffusion"), QT_TRANSLATE_NOOP("EffectModel", "Diffusion"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Tone"), QT_TRANSLATE_NOOP("EffectModel", "Tone"), 0xff},
+           {}}},
+         {0x80, 0x80, 0x80, 0x80, 0x80, 0x00}},
+        {effects::FENDER_65_SPRING_REVERB, 0x0b, {0x00, 0x08, 0x01}, EffectFamily::reverb, "Fender '65 Spring Reverb",
+         {{{QT_TRANSLATE_NOOP("EffectModel", "&Level"), QT_TRANSLATE_NOOP("EffectModel", "Level"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Decay"), QT_TRANSLATE_NOOP("EffectModel", "Decay"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "D&well"), QT_TRANSLATE_NOOP("EffectModel", "Dwell"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "D&iffusion"), QT_TRANSLATE_NOOP("EffectModel", "Diffusion"), 0xff},
+           {QT_TRANSLATE_NOOP("EffectModel", "&Tone"), QT_TRANSLATE_NOOP("EffectModel", "Tone"), 0xff},
+           {}}},
+         {0x80, 0x8b, 0x49, 0xff, 0x80, 0x00}},
+    }};
+
+
+    constexpr const EffectModel& effectModel(effects effect)
+    {
+        if (value(effect) >= effectModels.size())
+        {
+            throw std::invalid_argument{"Invalid effect: " + std::to_string(value(effect))};
+        }
+        return effectModels[value(effect)];
+    }
+
+}
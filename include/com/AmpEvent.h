@@ -0,0 +1,53 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "SignalChain.h"
+#include "data_structs.h"
+#include <variant>
+#include <cstdint>
+
+namespace plug::com
+{
+    namespace event
+    {
+        // Knob of the amp section turned on the amp
+        struct AmpChanged
+        {
+            amp_settings amp;
+        };
+
+        // Knob or model of an effect changed on the amp
+        struct EffectChanged
+        {
+            fx_pedal_settings effect;
+        };
+
+        // Preset selected on the amp
+        struct PresetSelected
+        {
+            std::uint8_t slot;
+            SignalChain signalChain;
+        };
+    }
+
+    using AmpEvent = std::variant<event::AmpChanged, event::EffectChanged, event::PresetSelected>;
+}
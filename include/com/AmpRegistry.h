@@ -0,0 +1,67 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "com/AsyncMustang.h"
+#include "com/Mustang.h"
+#include "com/PresetCache.h"
+#include <algorithm>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace plug::com
+{
+    // All connected amps, each driven by its own AsyncMustang and thus its own
+    // worker thread, so commands for different amps run in parallel. Amps are
+    // addressed by their index or all at once. MainWindow still drives a
+    // single amp; the registry is for clients that operate several.
+    class AmpRegistry
+    {
+    public:
+        explicit AmpRegistry(std::vector<std::unique_ptr<Mustang>> devices);
+        AmpRegistry(const AmpRegistry&) = delete;
+
+        std::size_t size() const noexcept;
+        bool empty() const noexcept;
+        AsyncMustang& at(std::size_t index);
+        std::vector<DeviceIdentity> identities() const;
+
+        // Queues the command on every amp at once; the results are in the
+        // order of the amps
+        template <class Command>
+        std::vector<std::future<std::invoke_result_t<Command, Mustang&>>> runAll(Command command)
+        {
+            std::vector<std::future<std::invoke_result_t<Command, Mustang&>>> results;
+            results.reserve(amps.size());
+            std::transform(amps.cbegin(), amps.cend(), std::back_inserter(results), [&command](const auto& amp)
+                           { return amp->run(command); });
+            return results;
+        }
+
+        AmpRegistry& operator=(const AmpRegistry&) = delete;
+
+    private:
+        std::vector<std::unique_ptr<AsyncMustang>> amps;
+    };
+}
@@ -0,0 +1,70 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "com/Mustang.h"
+#include "com/CommandExecutor.h"
+#include <future>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+namespace plug::com
+{
+    // Forwards every call to the Mustang on its own worker thread, so the caller
+    // never blocks on USB transfers. Observers are called on the worker thread.
+    class AsyncMustang
+    {
+    public:
+        explicit AsyncMustang(std::unique_ptr<Mustang> device);
+        AsyncMustang(const AsyncMustang&) = delete;
+
+        // Runs the command with the device on the worker thread
+        template <class Command>
+        std::future<std::invoke_result_t<Command, Mustang&>> run(Command command)
+        {
+            return executor.submit([this, command = std::move(command)]() mutable
+                                   { return command(*mustang); });
+        }
+
+        std::future<InitialData> start_amp(StartObserver observer);
+        std::future<void> stop_amp();
+        std::future<void> set_effect(fx_pedal_settings value);
+        std::future<void> set_amplifier(amp_settings value);
+        std::future<void> commit(CommandBatch batch);
+        std::future<std::size_t> apply(SignalChain chain);
+        std::future<void> save_on_amp(std::string name, std::uint8_t slot);
+        std::future<SignalChain> load_memory_bank(std::uint8_t slot);
+        std::future<void> save_effects(std::uint8_t slot, std::string name, std::vector<fx_pedal_settings> effects);
+        std::future<void> track(AmpEvent ampEvent);
+
+        DeviceModel getDeviceModel() const;
+        DeviceIdentity getDeviceIdentity() const;
+
+        AsyncMustang& operator=(const AsyncMustang&) = delete;
+
+    private:
+        const std::unique_ptr<Mustang> mustang;
+        const DeviceModel model;
+        const DeviceIdentity identity;
+        CommandExecutor executor;
+    };
+}
@@ -0,0 +1,56 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "SignalChain.h"
+#include "com/AmpRegistry.h"
+#include <chrono>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace plug::com
+{
+    struct AmpBroadcastResult
+    {
+        // From the common start until the amp acknowledged the apply command
+        std::chrono::microseconds latency;
+        std::optional<std::string> error;
+    };
+
+    struct BroadcastStats
+    {
+        std::vector<AmpBroadcastResult> amps;
+        std::size_t packets;
+        std::chrono::microseconds fastest;
+        std::chrono::microseconds slowest;
+        std::chrono::microseconds spread;
+    };
+
+
+    // Writes the signal chain to every amp of the registry at the same time.
+    // The packets are serialized once; the workers of all amps are released
+    // together, so the amps change within the spread of their transfer times
+    // instead of one after another. Results are in the order of the amps, the
+    // fastest, slowest and spread only cover amps without error. There's no
+    // broadcast action in the main window, which operates a single amp.
+    BroadcastStats broadcast(AmpRegistry& registry, const SignalChain& chain);
+}
@@ -0,0 +1,58 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "data_structs.h"
+#include "SignalChain.h"
+#include "com/Packet.h"
+#include <optional>
+#include <vector>
+#include <cstdint>
+
+namespace plug::com
+{
+    // DSP writes collected for a single apply command, see Mustang::commit().
+    class CommandBatch
+    {
+    public:
+        void set_amplifier(amp_settings value);
+        void set_effect(fx_pedal_settings value);
+
+        // Writes the whole chain: the amp and every effect DSP, either with
+        // its effect or cleared. Earlier amp and effect writes are dropped,
+        // later ones apply on top of the chain.
+        void set_signal_chain(const SignalChain& chain);
+
+        bool empty() const noexcept;
+        std::size_t size() const noexcept;
+
+        const std::vector<PacketRawType>& packets() const noexcept;
+        const std::optional<amp_settings>& amplifier() const noexcept;
+        const std::vector<fx_pedal_settings>& effects() const noexcept;
+        const std::optional<SignalChain>& signalChain() const noexcept;
+
+    private:
+        std::vector<PacketRawType> packets_;
+        std::optional<amp_settings> amp_;
+        std::vector<fx_pedal_settings> effects_;
+        std::optional<SignalChain> signalChain_;
+    };
+}
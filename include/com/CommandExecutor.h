@@ -0,0 +1,71 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "com/MpscQueue.h"
+#include <atomic>
+#include <functional>
+#include <future>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <cstdint>
+
+namespace plug::com
+{
+    // Runs commands on a dedicated worker thread, one after another in the order
+    // they were submitted. Pending commands are still run on destruction.
+    // Submitting doesn't lock; the worker sleeps on an atomic while idle.
+    class CommandExecutor
+    {
+    public:
+        CommandExecutor();
+        CommandExecutor(const CommandExecutor&) = delete;
+        ~CommandExecutor();
+
+        template <class Command>
+        std::future<std::invoke_result_t<Command>> submit(Command command)
+        {
+            using Result = std::invoke_result_t<Command>;
+
+            auto task = std::make_shared<std::packaged_task<Result()>>(std::move(command));
+            auto result = task->get_future();
+            enqueue([task]
+                    { (*task)(); });
+            return result;
+        }
+
+        std::size_t pending() const;
+        bool isWorkerThread() const;
+
+        CommandExecutor& operator=(const CommandExecutor&) = delete;
+
+    private:
+        void enqueue(std::function<void()> command);
+        void run();
+
+        MpscQueue<std::function<void()>> queue_;
+        std::atomic<std::size_t> pending_;
+        std::atomic<std::uint32_t> wakeups_;
+        std::atomic<bool> running_;
+        std::thread thread_;
+    };
+}
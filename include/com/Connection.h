@@ -22,6 +22,9 @@
 
 #include <vector>
 #include <string>
+#include <span>
+#include <future>
+#include <algorithm>
 #include <cstdint>
 
 namespace plug::com
@@ -35,17 +38,49 @@ namespace plug::com
         virtual void close() = 0;
         virtual bool isOpen() const = 0;
 
-        template <class Container>
-        std::size_t send(Container c)
+        std::size_t send(std::span<const std::uint8_t> data)
         {
-            return sendImpl(c.data(), c.size());
+            return sendImpl(data.data(), data.size());
         }
 
         virtual std::vector<std::uint8_t> receive(std::size_t recvSize) = 0;
 
+        std::size_t receive(std::span<std::uint8_t> buffer)
+        {
+            return receiveImpl(buffer.data(), buffer.size());
+        }
+
+        virtual std::future<std::vector<std::uint8_t>> receiveAsync(std::size_t recvSize)
+        {
+            std::promise<std::vector<std::uint8_t>> result;
+            result.set_value(receive(recvSize));
+            return result.get_future();
+        }
+
+        // The buffer must stay valid until the returned future is ready
+        std::future<std::size_t> receiveAsync(std::span<std::uint8_t> buffer)
+        {
+            return receiveAsyncImpl(buffer.data(), buffer.size());
+        }
+
         virtual std::string name() const = 0;
 
     private:
-        virtual std::size_t sendImpl(std::uint8_t* data, std::size_t size) = 0;
+        virtual std::size_t sendImpl(const std::uint8_t* data, std::size_t size) = 0;
+
+        virtual std::size_t receiveImpl(std::uint8_t* data, std::size_t size)
+        {
+            const auto received = receive(size);
+            const auto n = std::min(received.size(), size);
+            std::copy_n(received.cbegin(), n, data);
+            return n;
+        }
+
+        virtual std::future<std::size_t> receiveAsyncImpl(std::uint8_t* data, std::size_t size)
+        {
+            std::promise<std::size_t> result;
+            result.set_value(receiveImpl(data, size));
+            return result.get_future();
+        }
     };
 }
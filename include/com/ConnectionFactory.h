@@ -20,7 +20,11 @@
 
 #pragma once
 
+#include "com/AmpEvent.h"
+#include "com/UsbContext.h"
+#include <functional>
 #include <memory>
+#include <vector>
 
 namespace plug::com
 {
@@ -28,4 +32,19 @@ namespace plug::com
 
 
     std::unique_ptr<Mustang> connect();
+
+    // Connects to every amp found; amps that can't be opened are skipped
+    std::vector<std::unique_ptr<Mustang>> connectAll();
+
+    // Connects and reports changes made on the amp itself; the handler is
+    // called from the listening thread.
+    std::unique_ptr<Mustang> connect(std::function<void(const AmpEvent&)> eventHandler);
+
+    // Connects to an amp reported by watchAmps()
+    std::unique_ptr<Mustang> connect(usb::Device device, std::function<void(const AmpEvent&)> eventHandler);
+
+    // Reports amps as they are plugged in or removed, including those already
+    // present (see usb::Hotplug for the calling thread); returns nullptr if
+    // the platform has no hotplug support.
+    std::unique_ptr<usb::Hotplug> watchAmps(usb::Hotplug::Handler handler);
 }
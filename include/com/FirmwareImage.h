@@ -0,0 +1,60 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "com/Packet.h"
+#include <chrono>
+#include <span>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace plug::com
+{
+    // Time for one packet and the amp's answer on a full-speed interrupt endpoint
+    inline constexpr std::chrono::microseconds typicalRoundTrip{2000};
+
+
+    // A validated .upd firmware file, split into the packets sent to the amp
+    // in update mode: the build date, the numbered payload chunks and the
+    // finish packet.
+    class FirmwareImage
+    {
+    public:
+        // Throws std::invalid_argument if the data isn't a firmware image
+        explicit FirmwareImage(std::span<const std::uint8_t> data);
+
+        const std::string& date() const noexcept;
+        std::size_t payloadSize() const noexcept;
+        const std::vector<PacketRawType>& packets() const noexcept;
+
+        std::chrono::milliseconds estimateDuration(std::chrono::microseconds roundTrip = typicalRoundTrip) const;
+
+    private:
+        std::string date_;
+        std::size_t payloadSize_;
+        std::vector<PacketRawType> packets_;
+    };
+
+
+    // Throws std::runtime_error if the file can't be read
+    FirmwareImage loadFirmwareImage(const std::string& filename);
+}
@@ -21,6 +21,9 @@
 #pragma once
 
 #include "effects_enum.h"
+#include "EffectModel.h"
+#include <array>
+#include <optional>
 #include <cstdint>
 #include <stdexcept>
 #include <string>
@@ -28,169 +31,177 @@
 namespace plug
 {
 
-    constexpr amps lookupAmpById(std::uint8_t id)
+    struct AmpModel
+    {
+        amps model;
+        std::uint8_t id;
+        std::uint8_t ampSpecific;     // Amp payload bytes 28 - 30 and 34
+        std::uint8_t ampSpecificLast; // Amp payload byte 38
+        std::uint8_t unknown;         // Amp payload bytes 24 and 27
+    };
+
+    struct CabinetModel
     {
-        switch (id)
+        cabinets model;
+        std::uint8_t id;
+    };
+
+
+    // Ordered by enum value, so the model is also the index
+    inline constexpr std::array<AmpModel, 17> ampModels{{
+        {amps::FENDER_57_DELUXE, 0x67, 0x01, 0x53, 0x80},
+        {amps::FENDER_59_BASSMAN, 0x64, 0x02, 0x67, 0x80},
+        {amps::FENDER_57_CHAMP, 0x7c, 0x0c, 0x00, 0x80},
+        {amps::FENDER_65_DELUXE_REVERB, 0x53, 0x03, 0x6a, 0x00},
+        {amps::FENDER_65_PRINCETON, 0x6a, 0x04, 0x61, 0x80},
+        {amps::FENDER_65_TWIN_REVERB, 0x75, 0x05, 0x72, 0x80},
+        {amps::FENDER_SUPER_SONIC, 0x72, 0x06, 0x79, 0x80},
+        {amps::BRITISH_60S, 0x61, 0x07, 0x5e, 0x80},
+        {amps::BRITISH_70S, 0x79, 0x0b, 0x7c, 0x80},
+        {amps::BRITISH_80S, 0x5e, 0x09, 0x5d, 0x80},
+        {amps::AMERICAN_90S, 0x5d, 0x0a, 0x6d, 0x80},
+        {amps::METAL_2000, 0x6d, 0x08, 0x75, 0x80},
+        {amps::STUDIO_PREAMP, 0xf1, 0x0d, 0xf6, 0x80},
+        {amps::FENDER_57_TWIN, 0xf6, 0x0e, 0xf9, 0x80},
+        {amps::FENDER_60_THRIFT, 0xf9, 0x0f, 0xfc, 0x80},
+        {amps::BRITISH_COLOUR, 0xfc, 0x10, 0xff, 0x80},
+        {amps::BRITISH_WATTS, 0xff, 0x11, 0x00, 0x80},
+    }};
+
+    inline constexpr std::array<CabinetModel, 13> cabinetModels{{
+        {cabinets::OFF, 0x00},
+        {cabinets::cab57DLX, 0x01},
+        {cabinets::cabBSSMN, 0x02},
+        {cabinets::cab65DLX, 0x03},
+        {cabinets::cab65PRN, 0x04},
+        {cabinets::cabCHAMP, 0x05},
+        {cabinets::cab4x12M, 0x06},
+        {cabinets::cab2x12C, 0x07},
+        {cabinets::cab4x12G, 0x08},
+        {cabinets::cab65TWN, 0x09},
+        {cabinets::cab4x12V, 0x0a},
+        {cabinets::cabSS212, 0x0b},
+        {cabinets::cabSS112, 0x0c},
+    }};
+
+
+    namespace detail
+    {
+        template <class Model, std::size_t N>
+        constexpr bool isValidRegistry(const std::array<Model, N>& models)
         {
-            case 0x67:
-                return amps::FENDER_57_DELUXE;
-            case 0x64:
-                return amps::FENDER_59_BASSMAN;
-            case 0x7c:
-                return amps::FENDER_57_CHAMP;
-            case 0x53:
-                return amps::FENDER_65_DELUXE_REVERB;
-            case 0x6a:
-                return amps::FENDER_65_PRINCETON;
-            case 0x75:
-                return amps::FENDER_65_TWIN_REVERB;
-            case 0x72:
-                return amps::FENDER_SUPER_SONIC;
-            case 0x61:
-                return amps::BRITISH_60S;
-            case 0x79:
-                return amps::BRITISH_70S;
-            case 0x5e:
-                return amps::BRITISH_80S;
-            case 0x5d:
-                return amps::AMERICAN_90S;
-            case 0x6d:
-                return amps::METAL_2000;
-            case 0xf1:
-                return amps::STUDIO_PREAMP;
-            case 0xf6:
-                return amps::FENDER_57_TWIN;
-            case 0xf9:
-                return amps::FENDER_60_THRIFT;
-            case 0xfc:
-                return amps::BRITISH_COLOUR;
-            case 0xff:
-                return amps::BRITISH_WATTS;
-            default:
-                throw std::invalid_argument{"Invalid amp id: " + std::to_string(id)};
+            std::array<bool, 256> used{};
+
+            for (std::size_t i = 0; i < models.size(); ++i)
+            {
+                if ((value(models[i].model) != i) || used[models[i].id])
+                {
+                    return false;
+                }
+                used[models[i].id] = true;
+            }
+            return true;
         }
+
+        inline constexpr std::uint8_t noModel{0xff};
+
+        // Maps each of the 256 ids to the enum value of its model or noModel
+        template <class Model, std::size_t N>
+        constexpr std::array<std::uint8_t, 256> indexById(const std::array<Model, N>& models)
+        {
+            static_assert(N < noModel);
+            std::array<std::uint8_t, 256> index{};
+            index.fill(noModel);
+
+            for (const auto& m : models)
+            {
+                index[m.id] = value(m.model);
+            }
+            return index;
+        }
+
+        template <class Enum>
+        constexpr std::optional<Enum> findById(const std::array<std::uint8_t, 256>& index, std::uint8_t id)
+        {
+            const auto model = index[id];
+
+            if (model == noModel)
+            {
+                return std::nullopt;
+            }
+            return static_cast<Enum>(model);
+        }
+
+        static_assert(isValidRegistry(ampModels));
+        static_assert(isValidRegistry(effectModels));
+        static_assert(isValidRegistry(cabinetModels));
+
+        inline constexpr auto ampsById = indexById(ampModels);
+        inline constexpr auto effectsById = indexById(effectModels);
+        inline constexpr auto cabinetsById = indexById(cabinetModels);
     }
 
 
-    constexpr effects lookupEffectById(std::uint8_t id)
+    constexpr const AmpModel& ampModel(amps amp)
     {
-        switch (id)
+        if (value(amp) >= ampModels.size())
         {
-            case 0x00:
-                return effects::EMPTY;
-            case 0x3c:
-                return effects::OVERDRIVE;
-            case 0x49:
-                return effects::WAH;
-            case 0x4a:
-                return effects::TOUCH_WAH;
-            case 0x1a:
-                return effects::FUZZ;
-            case 0x1c:
-                return effects::FUZZ_TOUCH_WAH;
-            case 0x88:
-                return effects::SIMPLE_COMP;
-            case 0x07:
-                return effects::COMPRESSOR;
-            case 0x12:
-                return effects::SINE_CHORUS;
-            case 0x13:
-                return effects::TRIANGLE_CHORUS;
-            case 0x18:
-                return effects::SINE_FLANGER;
-            case 0x19:
-                return effects::TRIANGLE_FLANGER;
-            case 0x2d:
-                return effects::VIBRATONE;
-            case 0x40:
-                return effects::VINTAGE_TREMOLO;
-            case 0x41:
-                return effects::SINE_TREMOLO;
-            case 0x22:
-                return effects::RING_MODULATOR;
-            case 0x29:
-                return effects::STEP_FILTER;
-            case 0x4f:
-                return effects::PHASER;
-            case 0x1f:
-                return effects::PITCH_SHIFTER;
-            case 0x16:
-                return effects::MONO_DELAY;
-            case 0x43:
-                return effects::MONO_ECHO_FILTER;
-            case 0x48:
-                return effects::STEREO_ECHO_FILTER;
-            case 0x44:
-                return effects::MULTITAP_DELAY;
-            case 0x45:
-                return effects::PING_PONG_DELAY;
-            case 0x15:
-                return effects::DUCKING_DELAY;
-            case 0x46:
-                return effects::REVERSE_DELAY;
-            case 0x2b:
-                return effects::TAPE_DELAY;
-            case 0x2a:
-                return effects::STEREO_TAPE_DELAY;
-            case 0x24:
-                return effects::SMALL_HALL_REVERB;
-            case 0x3a:
-                return effects::LARGE_HALL_REVERB;
-            case 0x26:
-                return effects::SMALL_ROOM_REVERB;
-            case 0x3b:
-                return effects::LARGE_ROOM_REVERB;
-            case 0x4e:
-                return effects::SMALL_PLATE_REVERB;
-            case 0x4b:
-                return effects::LARGE_PLATE_REVERB;
-            case 0x4c:
-                return effects::AMBIENT_REVERB;
-            case 0x4d:
-                return effects::ARENA_REVERB;
-            case 0x21:
-                return effects::FENDER_63_SPRING_REVERB;
-            case 0x0b:
-                return effects::FENDER_65_SPRING_REVERB;
-            default:
-                throw std::invalid_argument{"Invalid effect id: " + std::to_string(id)};
+            throw std::invalid_argument{"Invalid amp: " + std::to_string(value(amp))};
         }
+        return ampModels[value(amp)];
     }
 
+    constexpr const CabinetModel& cabinetModel(cabinets cabinet)
+    {
+        if (value(cabinet) >= cabinetModels.size())
+        {
+            throw std::invalid_argument{"Invalid cabinet: " + std::to_string(value(cabinet))};
+        }
+        return cabinetModels[value(cabinet)];
+    }
+
+
+    constexpr std::optional<amps> findAmpById(std::uint8_t id)
+    {
+        return detail::findById<amps>(detail::ampsById, id);
+    }
+
+    constexpr std::optional<effects> findEffectById(std::uint8_t id)
+    {
+        return detail::findById<effects>(detail::effectsById, id);
+    }
+
+    constexpr std::optional<cabinets> findCabinetById(std::uint8_t id)
+    {
+        return detail::findById<cabinets>(detail::cabinetsById, id);
+    }
+
+
+    constexpr amps lookupAmpById(std::uint8_t id)
+    {
+        if (const auto amp = findAmpById(id))
+        {
+            return *amp;
+        }
+        throw std::invalid_argument{"Invalid amp id: " + std::to_string(id)};
+    }
+
+    constexpr effects lookupEffectById(std::uint8_t id)
+    {
+        if (const auto effect = findEffectById(id))
+        {
+            return *effect;
+        }
+        throw std::invalid_argument{"Invalid effect id: " + std::to_string(id)};
+    }
 
     constexpr cabinets lookupCabinetById(std::uint8_t id)
     {
-        switch (id)
+        if (const auto cabinet = findCabinetById(id))
         {
-            case 0x00:
-                return cabinets::OFF;
-            case 0x01:
-                return cabinets::cab57DLX;
-            case 0x02:
-                return cabinets::cabBSSMN;
-            case 0x03:
-                return cabinets::cab65DLX;
-            case 0x04:
-                return cabinets::cab65PRN;
-            case 0x05:
-                return cabinets::cabCHAMP;
-            case 0x06:
-                return cabinets::cab4x12M;
-            case 0x07:
-                return cabinets::cab2x12C;
-            case 0x08:
-                return cabinets::cab4x12G;
-            case 0x09:
-                return cabinets::cab65TWN;
-            case 0x0a:
-                return cabinets::cab4x12V;
-            case 0x0b:
-                return cabinets::cabSS212;
-            case 0x0c:
-                return cabinets::cabSS112;
-            default:
-                throw std::invalid_argument{"Invalid cabinet id: " + std::to_string(id)};
+            return *cabinet;
         }
+        throw std::invalid_argument{"Invalid cabinet id: " + std::to_string(id)};
     }
 
 }
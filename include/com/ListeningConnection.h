@@ -0,0 +1,95 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "com/AmpEvent.h"
+#include "com/Connection.h"
+#include "com/LoadStreamParser.h"
+#include "com/Packet.h"
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+namespace plug::com
+{
+    // Keeps IN transfers posted on the wrapped connection all the time, so
+    // packets the amp sends on its own (knobs turned, preset selected on the
+    // amp) are received as they happen and reported as events.
+    //
+    // Data packets of a DSP are always changes made on the amp, as the amp
+    // acknowledges writes without a DSP. Other packets are the response of a
+    // request if they arrive within the exchange window of a send or receive,
+    // otherwise they are a preset selected on the amp.
+    class ListeningConnection : public Connection
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+        using EventHandler = std::function<void(const AmpEvent&)>;
+
+        ListeningConnection(std::shared_ptr<Connection> connection, EventHandler handler,
+                            std::size_t postedTransfers = 4);
+        ListeningConnection(const ListeningConnection&) = delete;
+        ~ListeningConnection() override;
+
+        void close() override;
+        bool isOpen() const override;
+
+        using Connection::receive;
+        std::vector<std::uint8_t> receive(std::size_t recvSize) override;
+
+        std::string name() const override;
+
+        ListeningConnection& operator=(const ListeningConnection&) = delete;
+
+    private:
+        std::size_t sendImpl(const std::uint8_t* data, std::size_t size) override;
+        std::size_t receiveImpl(std::uint8_t* data, std::size_t size) override;
+
+        void stop();
+        void run();
+        void dispatch(const PacketRawType& packet);
+        void handleDspData(const PacketRawType& packet);
+        void notifyAmp();
+        void handleUnsolicited(const PacketRawType& packet);
+        void handleStreamEvent(const load::Event& loadEvent);
+        void notify(const AmpEvent& ampEvent);
+
+        const std::shared_ptr<Connection> connection_;
+        const EventHandler handler_;
+        const std::size_t postedTransfers_;
+        mutable std::mutex mutex_;
+        std::condition_variable responseAvailable_;
+        std::deque<PacketRawType> responses_;
+        Clock::time_point exchangeUntil_;
+        std::optional<Packet<AmpPayload>> lastAmp_;
+        Packet<AmpPayload> lastUsbGain_;
+        std::optional<std::uint8_t> selectedSlot_;
+        SignalChainBuilder selectedChain_;
+        std::unique_ptr<LoadStreamParser> selection_;
+        bool running_;
+        std::thread thread_;
+    };
+}
@@ -0,0 +1,92 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "com/CommandBatch.h"
+#include "data_structs.h"
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+namespace plug::com
+{
+    struct LiveStats
+    {
+        std::size_t updates;
+        std::size_t coalesced;
+        std::size_t transfers;
+        double transfersPerSecond;
+        std::chrono::microseconds averageLatency;
+        std::chrono::microseconds maxLatency;
+    };
+
+
+    // Streams dial changes to the amp while they happen. Only the newest value of
+    // each DSP is kept while a transfer is in flight, and transfers are started at
+    // most maxRate times per second. The latency is measured from the oldest
+    // update of a transfer until the transfer is done.
+    class LiveUpdater
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+        using Send = std::function<void(const CommandBatch&)>;
+        using StatsHandler = std::function<void(const LiveStats&)>;
+
+        LiveUpdater(Send send, unsigned int maxRate, StatsHandler statsHandler = {});
+        LiveUpdater(const LiveUpdater&) = delete;
+        ~LiveUpdater();
+
+        void update(const amp_settings& value);
+        void update(const fx_pedal_settings& value);
+        LiveStats stats() const;
+
+        LiveUpdater& operator=(const LiveUpdater&) = delete;
+
+    private:
+        struct Pending
+        {
+            std::optional<amp_settings> amp;
+            std::array<std::optional<fx_pedal_settings>, 4> effects;
+            std::optional<Clock::time_point> since;
+        };
+
+        void markPending(bool replaced);
+        bool hasPending() const;
+        void run();
+        void record(Clock::time_point since, Clock::time_point done);
+
+        const Send send_;
+        const Clock::duration interval_;
+        const StatsHandler statsHandler_;
+        mutable std::mutex mutex_;
+        std::condition_variable condition_;
+        Pending pending_;
+        LiveStats stats_;
+        std::optional<Clock::time_point> firstTransfer_;
+        std::chrono::microseconds totalLatency_;
+        bool running_;
+        std::thread thread_;
+    };
+}
@@ -0,0 +1,195 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "DeviceModel.h"
+#include "SignalChain.h"
+#include "com/Packet.h"
+#include "com/PacketArena.h"
+#include <array>
+#include <functional>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <cstdint>
+
+namespace plug::com
+{
+    namespace load
+    {
+        // Names, DSP data and knob preset effects refer to the packets kept by
+        // the parser and are only valid during the handler call
+
+        // Entry of the preset list
+        struct PresetName
+        {
+            std::uint8_t slot;
+            std::string_view name;
+        };
+
+        // Name of the current (or selected) preset, starts its state
+        struct CurrentName
+        {
+            std::uint8_t slot;
+            std::string_view name;
+        };
+
+        struct AmpState
+        {
+            PacketView<AmpPayload> packet;
+        };
+
+        // Last DSP of the state (0x0a)
+        struct UsbGainState
+        {
+            PacketView<AmpPayload> packet;
+        };
+
+        struct EffectState
+        {
+            std::size_t dspIndex;
+            PacketView<EffectPayload> packet;
+        };
+
+        struct ModKnobPreset
+        {
+            std::uint8_t slot;
+            std::string_view name;
+            std::span<const PacketRawType> effects;
+        };
+
+        struct DlyRevKnobPreset
+        {
+            std::uint8_t slot;
+            std::string_view name;
+            std::span<const PacketRawType> effects;
+        };
+
+        // The state (current name and DSP data) is complete
+        struct EndOfState
+        {
+        };
+
+        struct EndOfStream
+        {
+        };
+
+        using Event = std::variant<PresetName, CurrentName, AmpState, UsbGainState, EffectState,
+                                   EndOfState, ModKnobPreset, DlyRevKnobPreset, EndOfStream>;
+    }
+
+
+    // Classifies the packets of a load or bank selection stream as they arrive and
+    // passes typed events to the handler. Every packet of the stream is kept in
+    // an arena sized for the stream of the model, so parsing a complete stream
+    // allocates once.
+    //
+    // The load stream consists of the preset names (name + confirmation each), the
+    // current state (name, DSP data, confirmation), then the Mod knob presets and the
+    // Dly/Rev knob presets (name, data, confirmation each). The stream has no end
+    // marker, it's complete once the number of knob presets of the model is
+    // received; if that's unknown, it never finishes and ends by the receive
+    // timeout. A bank stream is only the state.
+    class LoadStreamParser
+    {
+    public:
+        enum class Stream
+        {
+            load,
+            bank
+        };
+
+        LoadStreamParser(Stream stream, std::function<void(const load::Event&)> handler);
+        LoadStreamParser(Stream stream, std::function<void(const load::Event&)> handler, const DeviceModel& model);
+
+        void push(const PacketRawType& packet);
+        bool finished() const noexcept;
+
+    private:
+        // Packets are referred to by their index in the arena
+        struct PendingPreset
+        {
+            std::uint8_t knob;
+            std::size_t name;
+        };
+
+        LoadStreamParser(Stream stream, std::function<void(const load::Event&)> handler,
+                         std::size_t numberModPresets, std::size_t numberDlyRevPresets, std::size_t capacity);
+
+        void pushState(std::size_t index, std::uint8_t dsp);
+        void pushKnobPreset(std::size_t index, std::uint8_t dsp, std::uint8_t knob);
+        std::string_view nameOf(std::size_t index) const;
+        std::uint8_t slotOf(std::size_t index) const;
+        void finish();
+
+        const Stream stream_;
+        const std::function<void(const load::Event&)> handler_;
+        const std::size_t expectedModPresets_;
+        const std::size_t expectedDlyRevPresets_;
+        PacketArena arena_;
+        std::optional<std::size_t> pendingName_;
+        std::optional<PendingPreset> pendingPreset_;
+        bool stateReceived_;
+        std::size_t modPresets_;
+        std::size_t dlyRevPresets_;
+        bool finished_;
+    };
+
+    // Collects the state events of a load or bank stream
+    class SignalChainBuilder
+    {
+    public:
+        void operator()(const load::CurrentName& event)
+        {
+            name = event.name;
+        }
+
+        void operator()(const load::AmpState& event)
+        {
+            amp = Packet<AmpPayload>{event.packet};
+        }
+
+        void operator()(const load::UsbGainState& event)
+        {
+            usbGain = Packet<AmpPayload>{event.packet};
+        }
+
+        void operator()(const load::EffectState& event)
+        {
+            effects[event.dspIndex] = Packet<EffectPayload>{event.packet};
+        }
+
+        template <class Event>
+        void operator()(const Event&)
+        {
+        }
+
+        SignalChain build() const;
+
+    private:
+        std::string name;
+        Packet<AmpPayload> amp;
+        Packet<AmpPayload> usbGain;
+        std::array<Packet<EffectPayload>, 4> effects;
+    };
+}
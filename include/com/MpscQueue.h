@@ -0,0 +1,91 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <optional>
+#include <utility>
+
+namespace plug::com
+{
+    // Unbounded multi-producer, single-consumer queue. push() neither locks nor
+    // waits, so any thread can hand over work without contending with others;
+    // pop() must only be called by the consumer thread.
+    //
+    // Each push links a new node behind the newest one with a single atomic
+    // exchange. A push that is still linking its node is not visible to pop()
+    // yet, which then returns nothing.
+    template <class T>
+    class MpscQueue
+    {
+    public:
+        MpscQueue()
+            : newest_(new Node{}), oldest_(newest_.load())
+        {
+        }
+
+        MpscQueue(const MpscQueue&) = delete;
+
+        ~MpscQueue()
+        {
+            while (pop())
+            {
+            }
+            delete oldest_;
+        }
+
+        void push(T value)
+        {
+            auto* node = new Node{std::move(value), nullptr};
+            Node* previous = newest_.exchange(node, std::memory_order_acq_rel);
+            previous->next.store(node, std::memory_order_release);
+        }
+
+        std::optional<T> pop()
+        {
+            Node* next = oldest_->next.load(std::memory_order_acquire);
+
+            if (next == nullptr)
+            {
+                return std::nullopt;
+            }
+
+            std::optional<T> value{std::move(next->value)};
+            next->value.reset();
+            delete oldest_;
+            oldest_ = next;
+            return value;
+        }
+
+        MpscQueue& operator=(const MpscQueue&) = delete;
+
+    private:
+        // The oldest node is a stub, its value has been taken already
+        struct Node
+        {
+            std::optional<T> value;
+            std::atomic<Node*> next;
+        };
+
+        std::atomic<Node*> newest_;
+        Node* oldest_;
+    };
+}
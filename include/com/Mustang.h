@@ -23,8 +23,13 @@
 
 #include "SignalChain.h"
 #include "DeviceModel.h"
+#include "com/AmpEvent.h"
 #include "com/Connection.h"
+#include "com/CommandBatch.h"
+#include "com/PresetCache.h"
 #include <string_view>
+#include <functional>
+#include <optional>
 #include <vector>
 #include <memory>
 #include <cstdint>
@@ -37,31 +42,55 @@ namespace plug::com
         std::vector<std::string> presetNames;
     };
 
+    // Receives the initial data while it's still being transferred; the
+    // preset names arrive first, the signal chain once its state is complete.
+    struct StartObserver
+    {
+        std::function<void(std::size_t, const std::string&)> presetName;
+        std::function<void(const SignalChain&)> signalChain;
+    };
+
     class Mustang
     {
     public:
         Mustang(DeviceModel deviceModel, std::shared_ptr<Connection> connection);
+        Mustang(DeviceModel deviceModel, std::shared_ptr<Connection> connection, DeviceIdentity deviceIdentity);
         Mustang(const Mustang&) = delete;
 
         InitialData start_amp();
+        InitialData start_amp(const StartObserver& observer);
         void stop_amp();
         void set_effect(fx_pedal_settings value);
         void set_amplifier(amp_settings value);
+        void commit(const CommandBatch& batch);
+
+        // Writes only the packets that differ from the cached state of the amp
+        // and returns their number; everything is written if there's no state yet.
+        std::size_t apply(const SignalChain& chain);
         void save_on_amp(std::string_view name, std::uint8_t slot);
         SignalChain load_memory_bank(std::uint8_t slot);
         void save_effects(std::uint8_t slot, std::string_view name, const std::vector<fx_pedal_settings>& effects);
 
+        // Keeps the cached state in line with changes made on the amp itself
+        void track(const AmpEvent& ampEvent);
+
         DeviceModel getDeviceModel() const;
+        DeviceIdentity getDeviceIdentity() const;
+        const std::optional<SignalChain>& cachedState() const;
 
 
         Mustang& operator=(const Mustang&) = delete;
 
 
     private:
-        InitialData loadData();
+        InitialData loadData(const StartObserver& observer);
         void initializeAmp();
+        void updateCachedState(const amp_settings& value);
+        void updateCachedState(const fx_pedal_settings& value);
 
         const DeviceModel model;
         const std::shared_ptr<Connection> conn;
+        const DeviceIdentity identity;
+        std::optional<SignalChain> state;
     };
 }
@@ -3,7 +3,6 @@
  *        Linux replacement for Fender FUSE software
  *
  * Copyright (C) 2017-2024  offa
- * Copyright (C) 2010-2016  piorekf <piorek@piorekf.org>
  *
  * This program is free software: you can redistribute it and/or modify
  * it under the terms of the GNU General Public License as published by
@@ -21,7 +20,40 @@
 
 #pragma once
 
+#include "com/Connection.h"
+#include "com/FirmwareImage.h"
+#include <chrono>
+#include <functional>
+#include <string>
+
 namespace plug::com
 {
-    int updateFirmware(const char* filename);
+    inline constexpr int updateErrorNoDevice{-100};
+    inline constexpr int updateErrorFile{-101};
+    inline constexpr int updateErrorImage{-102};
+
+
+    struct UpdateProgress
+    {
+        std::size_t packetsSent;
+        std::size_t packetsTotal;
+        std::chrono::milliseconds elapsed;
+        double bytesPerSecond;
+    };
+
+    using UpdateProgressHandler = std::function<void(const UpdateProgress&)>;
+
+
+    // Sends a firmware image to an amp in update mode. Each packet is sent as
+    // soon as the amp has answered the previous one; progress is reported
+    // after every packet.
+    void sendFirmware(Connection& device, const FirmwareImage& image, const UpdateProgressHandler& progress = {});
+
+    // Updates the first amp found in update mode. Returns 0 on success, one of
+    // the update errors above or a libusb error code. Blocks until finished,
+    // so call it from a worker thread.
+    int updateFirmware(const FirmwareImage& image, const UpdateProgressHandler& progress = {});
+
+    // As above, but the file is loaded and validated first
+    int updateFirmware(const std::string& filename, const UpdateProgressHandler& progress = {});
 }
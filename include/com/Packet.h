@@ -20,10 +20,14 @@
 
 #pragma once
 
+#include "com/PacketField.h"
 #include <array>
 #include <algorithm>
+#include <span>
+#include <stdexcept>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <cstdint>
 
 namespace plug::com
@@ -42,6 +46,10 @@ namespace plug::com
         opSelectMemBank
     };
 
+    // The USB gain is written on DSP::usbGain (0x0d), but the amp reports it on
+    // 0x0a, both in the load stream and when it's changed on the amp
+    inline constexpr std::uint8_t usbGainReportDsp{0x0a};
+
     enum class Type
     {
         operation,
@@ -59,149 +67,734 @@ namespace plug::com
         unknown
     };
 
-    class Header
+    constexpr std::size_t packetRawTypeSize = 64;
+    using PacketRawType = std::array<std::uint8_t, packetRawTypeSize>;
+
+    inline constexpr std::size_t packetHeaderSize{16};
+    inline constexpr std::size_t packetPayloadSize{48};
+
+    template <std::size_t N>
+    using OwnedBytes = std::array<std::uint8_t, N>;
+
+    template <std::size_t N>
+    using ConstBytes = std::span<const std::uint8_t, N>;
+
+    template <std::size_t N>
+    using MutableBytes = std::span<std::uint8_t, N>;
+
+
+    namespace layout
+    {
+        namespace header
+        {
+            using Stage = PacketField<0>;
+            using Type = PacketField<1>;
+            using DSP = PacketField<2>;
+            using Unknown0 = PacketField<3>;
+            using Slot = PacketField<4>;
+            using Unknown1 = PacketField<6>;
+            using Unknown2 = PacketField<7>;
+
+            using Fields = FieldLayout<Stage, Type, DSP, Unknown0, Slot, Unknown1, Unknown2>;
+        }
+
+        namespace name
+        {
+            using Name = PacketField<0, 32>;
+
+            using Fields = FieldLayout<Name>;
+        }
+
+        namespace effect
+        {
+            using Model = PacketField<0>;
+            using Slot = PacketField<2>;
+            using Unknown0 = PacketField<3>;
+            using Unknown1 = PacketField<4>;
+            using Unknown2 = PacketField<5>;
+            using Knob1 = PacketField<16>;
+            using Knob2 = PacketField<17>;
+            using Knob3 = PacketField<18>;
+            using Knob4 = PacketField<19>;
+            using Knob5 = PacketField<20>;
+            using Knob6 = PacketField<21>;
+
+            using Fields = FieldLayout<Model, Slot, Unknown0, Unknown1, Unknown2, Knob1, Knob2, Knob3, Knob4, Knob5, Knob6>;
+        }
+
+        namespace amp
+        {
+            using Model = PacketField<0>;
+            using Volume = PacketField<16>;
+            using Gain = PacketField<17>;
+            using Gain2 = PacketField<18>;
+            using MasterVolume = PacketField<19>;
+            using Treble = PacketField<20>;
+            using Middle = PacketField<21>;
+            using Bass = PacketField<22>;
+            using Presence = PacketField<23>;
+            using Unknown0 = PacketField<24>;
+            using Depth = PacketField<25>;
+            using Bias = PacketField<26>;
+            using Unknown1 = PacketField<27>;
+            using AmpSpecific0 = PacketField<28>;
+            using AmpSpecific1 = PacketField<29>;
+            using AmpSpecific2 = PacketField<30>;
+            using NoiseGate = PacketField<31, 1, 0x05>;
+            using Threshold = PacketField<32, 1, 0x09>;
+            using Cabinet = PacketField<33>;
+            using AmpSpecific3 = PacketField<34>;
+            using Sag = PacketField<35, 1, 0x02>;
+            using Brightness = PacketField<36>;
+            using Unknown2 = PacketField<37>;
+            using AmpSpecific4 = PacketField<38>;
+
+            using Fields = FieldLayout<Model, Volume, Gain, Gain2, MasterVolume, Treble, Middle, Bass, Presence,
+                                       Unknown0, Depth, Bias, Unknown1, AmpSpecific0, AmpSpecific1, AmpSpecific2,
+                                       NoiseGate, Threshold, Cabinet, AmpSpecific3, Sag, Brightness, Unknown2, AmpSpecific4>;
+
+            // Sent in a packet of its own (DSP::usbGain), so it reuses the model byte
+            using UsbGain = PacketField<0>;
+        }
+
+        static_assert(header::Fields::fitsInto<packetHeaderSize>());
+        static_assert(name::Fields::fitsInto<packetPayloadSize>());
+        static_assert(effect::Fields::fitsInto<packetPayloadSize>());
+        static_assert(amp::Fields::fitsInto<packetPayloadSize>());
+    }
+
+
+    // Header or payload part of a packet. The bytes are either owned or a span
+    // into a packet buffer, so the same accessors work on copies and in place.
+    template <std::size_t N, class Bytes>
+    class PacketSection
     {
     public:
-        using RawType = std::array<std::uint8_t, 16>;
+        using RawType = std::array<std::uint8_t, N>;
 
-        void setStage(Stage stage);
-        Stage getStage() const;
+        constexpr PacketSection()
+            : bytes{}
+        {
+        }
 
-        void setType(Type type);
-        Type getType() const;
+        constexpr explicit PacketSection(Bytes data)
+            : bytes(data)
+        {
+        }
 
-        void setDSP(DSP dsp);
-        DSP getDSP() const;
+        constexpr RawType getBytes() const
+        {
+            RawType data{};
+            std::copy(bytes.begin(), bytes.end(), data.begin());
+            return data;
+        }
 
-        void setSlot(std::uint8_t slot);
-        std::uint8_t getSlot() const;
+        constexpr void fromBytes(const RawType& data)
+        {
+            std::copy(data.cbegin(), data.cend(), bytes.begin());
+        }
 
-        void setUnknown(std::uint8_t value0, std::uint8_t value1, std::uint8_t value2);
+        template <class F>
+        constexpr std::uint8_t get() const
+            requires(F::width == 1)
+        {
+            static_assert(F::offset < N, "Field outside of section");
+            return bytes[F::offset];
+        }
 
-        RawType getBytes() const;
-        void fromBytes(const RawType& data);
+        template <class F>
+        constexpr void set(std::uint8_t value)
+            requires(F::width == 1)
+        {
+            static_assert(F::offset < N, "Field outside of section");
+            bytes[F::offset] = value;
+        }
 
-    private:
-        RawType bytes{{}};
+        template <class F>
+        constexpr auto field() const
+        {
+            static_assert((F::offset + F::width) <= N, "Field outside of section");
+            return std::span{bytes}.template subspan<F::offset, F::width>();
+        }
+
+        template <class F>
+        constexpr auto field()
+        {
+            static_assert((F::offset + F::width) <= N, "Field outside of section");
+            return std::span{bytes}.template subspan<F::offset, F::width>();
+        }
+
+    protected:
+        Bytes bytes;
     };
 
 
-    class PayloadBase
+    template <class Bytes = OwnedBytes<packetHeaderSize>>
+    class BasicHeader : public PacketSection<packetHeaderSize, Bytes>
     {
     public:
-        using RawType = std::array<std::uint8_t, 48>;
+        using PacketSection<packetHeaderSize, Bytes>::PacketSection;
+
+        constexpr void setStage(Stage stage)
+        {
+            this->template set<layout::header::Stage>([stage]() -> std::uint8_t
+            {
+                switch (stage)
+                {
+                    case Stage::init0:
+                        return 0x00;
+                    case Stage::init1:
+                        return 0x1a;
+                    case Stage::ready:
+                        return 0x1c;
+                    default:
+                        return 0xff;
+                }
+            }());
+        }
 
-        RawType getBytes() const;
-        void fromBytes(const RawType& data);
+        constexpr Stage getStage() const
+        {
+            switch (this->template get<layout::header::Stage>())
+            {
+                case 0x00:
+                    return Stage::init0;
+                case 0x1a:
+                    return Stage::init1;
+                case 0x1c:
+                    return Stage::ready;
+                default:
+                    return Stage::unknown;
+            }
+        }
 
-    protected:
-        RawType bytes{{}};
+        constexpr void setType(Type type)
+        {
+            this->template set<layout::header::Type>([type]() -> std::uint8_t
+            {
+                switch (type)
+                {
+                    case Type::operation:
+                        return 0x01;
+                    case Type::data:
+                        return 0x03;
+                    case Type::init0:
+                        return 0xc3;
+                    case Type::init1:
+                        return 0xc1; // 0x03 in the original implementation but seems to work on v2 devices too
+                    case Type::load:
+                        return 0xc1;
+                    default:
+                        return 0xff;
+                }
+            }());
+        }
+
+        constexpr Type getType() const
+        {
+            switch (this->template get<layout::header::Type>())
+            {
+                case 0x01:
+                    return Type::operation;
+                case 0x03:
+                    return Type::data; // Same value as Type::init1
+                case 0xc3:
+                    return Type::init0;
+                case 0xc1:
+                    return Type::load;
+                default:
+                    throw std::domain_error("Invalid Type: " + std::to_string(this->template get<layout::header::Type>()));
+            }
+        }
+
+        constexpr void setDSP(DSP dsp)
+        {
+            this->template set<layout::header::DSP>([dsp]() -> std::uint8_t
+            {
+                switch (dsp)
+                {
+                    case DSP::none:
+                        return 0x00;
+                    case DSP::amp:
+                        return 0x05;
+                    case DSP::usbGain:
+                        return 0x0d;
+                    case DSP::effect0:
+                        return 0x06;
+                    case DSP::effect1:
+                        return 0x07;
+                    case DSP::effect2:
+                        return 0x08;
+                    case DSP::effect3:
+                        return 0x09;
+                    case DSP::opSave:
+                        return 0x03;
+                    case DSP::opSaveEffectName:
+                        return 0x04;
+                    case DSP::opSelectMemBank:
+                        return 0x01;
+                    default:
+                        return 0xff;
+                }
+            }());
+        }
+
+        constexpr DSP getDSP() const
+        {
+            switch (this->template get<layout::header::DSP>())
+            {
+                case 0x00:
+                    return DSP::none;
+                case 0x05:
+                    return DSP::amp;
+                case 0x0d:
+                    return DSP::usbGain;
+                case 0x06:
+                    return DSP::effect0;
+                case 0x07:
+                    return DSP::effect1;
+                case 0x08:
+                    return DSP::effect2;
+                case 0x09:
+                    return DSP::effect3;
+                case 0x03:
+                    return DSP::opSave;
+                case 0x04:
+                    return DSP::opSaveEffectName;
+                case 0x01:
+                    return DSP::opSelectMemBank;
+                default:
+                    throw std::domain_error("Invalid DSP: " + std::to_string(this->template get<layout::header::DSP>()));
+            }
+        }
+
+        constexpr void setSlot(std::uint8_t slot)
+        {
+            this->template set<layout::header::Slot>(slot);
+        }
+
+        constexpr std::uint8_t getSlot() const
+        {
+            return this->template get<layout::header::Slot>();
+        }
+
+        constexpr void setUnknown(std::uint8_t value0, std::uint8_t value1, std::uint8_t value2)
+        {
+            this->template set<layout::header::Unknown0>(value0);
+            this->template set<layout::header::Unknown1>(value1);
+            this->template set<layout::header::Unknown2>(value2);
+        }
     };
 
-    class EmptyPayload : public PayloadBase
+    using Header = BasicHeader<>;
+
+
+    template <class Bytes = OwnedBytes<packetPayloadSize>>
+    class BasicEmptyPayload : public PacketSection<packetPayloadSize, Bytes>
     {
     public:
+        template <class Other>
+        using Rebind = BasicEmptyPayload<Other>;
+
+        using PacketSection<packetPayloadSize, Bytes>::PacketSection;
     };
 
-    class NamePayload : public PayloadBase
+    using EmptyPayload = BasicEmptyPayload<>;
+
+
+    template <class Bytes = OwnedBytes<packetPayloadSize>>
+    class BasicNamePayload : public PacketSection<packetPayloadSize, Bytes>
     {
     public:
-        void setName(std::string_view name);
-        std::string getName() const;
+        template <class Other>
+        using Rebind = BasicNamePayload<Other>;
+
+        using PacketSection<packetPayloadSize, Bytes>::PacketSection;
+
+        constexpr void setName(std::string_view name)
+        {
+            auto data = this->template field<layout::name::Name>();
+            std::copy_n(name.cbegin(), std::min(name.length(), data.size()), data.begin());
+        }
+
+        constexpr std::string getName() const
+        {
+            const auto data = this->template field<layout::name::Name>();
+            return std::string(data.begin(), std::find(data.begin(), data.end(), '\0'));
+        }
+
+        // Refers to the bytes of the payload
+        std::string_view getNameView() const
+        {
+            const auto data = this->template field<layout::name::Name>();
+            const auto length = std::find(data.begin(), data.end(), '\0') - data.begin();
+            return std::string_view{reinterpret_cast<const char*>(data.data()), static_cast<std::size_t>(length)};
+        }
     };
 
-    class EffectPayload : public PayloadBase
+    using NamePayload = BasicNamePayload<>;
+
+
+    template <class Bytes = OwnedBytes<packetPayloadSize>>
+    class BasicEffectPayload : public PacketSection<packetPayloadSize, Bytes>
     {
     public:
-        void setKnob1(std::uint8_t value);
-        std::uint8_t getKnob1() const;
+        template <class Other>
+        using Rebind = BasicEffectPayload<Other>;
 
-        void setKnob2(std::uint8_t value);
-        std::uint8_t getKnob2() const;
+        using PacketSection<packetPayloadSize, Bytes>::PacketSection;
 
-        void setKnob3(std::uint8_t value);
-        std::uint8_t getKnob3() const;
+        constexpr void setKnob1(std::uint8_t value)
+        {
+            this->template set<layout::effect::Knob1>(value);
+        }
 
-        void setKnob4(std::uint8_t value);
-        std::uint8_t getKnob4() const;
+        constexpr std::uint8_t getKnob1() const
+        {
+            return this->template get<layout::effect::Knob1>();
+        }
 
-        void setKnob5(std::uint8_t value);
-        std::uint8_t getKnob5() const;
+        constexpr void setKnob2(std::uint8_t value)
+        {
+            this->template set<layout::effect::Knob2>(value);
+        }
 
-        void setKnob6(std::uint8_t value);
-        std::uint8_t getKnob6() const;
+        constexpr std::uint8_t getKnob2() const
+        {
+            return this->template get<layout::effect::Knob2>();
+        }
 
-        void setSlot(std::uint8_t slot);
-        std::uint8_t getSlot() const;
+        constexpr void setKnob3(std::uint8_t value)
+        {
+            this->template set<layout::effect::Knob3>(value);
+        }
 
-        void setModel(std::uint8_t model);
-        std::uint8_t getModel() const;
+        constexpr std::uint8_t getKnob3() const
+        {
+            return this->template get<layout::effect::Knob3>();
+        }
 
-        void setUnknown(std::uint8_t value0, std::uint8_t value1, std::uint8_t value2);
+        constexpr void setKnob4(std::uint8_t value)
+        {
+            this->template set<layout::effect::Knob4>(value);
+        }
+
+        constexpr std::uint8_t getKnob4() const
+        {
+            return this->template get<layout::effect::Knob4>();
+        }
+
+        constexpr void setKnob5(std::uint8_t value)
+        {
+            this->template set<layout::effect::Knob5>(value);
+        }
+
+        constexpr std::uint8_t getKnob5() const
+        {
+            return this->template get<layout::effect::Knob5>();
+        }
+
+        constexpr void setKnob6(std::uint8_t value)
+        {
+            this->template set<layout::effect::Knob6>(value);
+        }
+
+        constexpr std::uint8_t getKnob6() const
+        {
+            return this->template get<layout::effect::Knob6>();
+        }
+
+        constexpr void setSlot(std::uint8_t slot)
+        {
+            this->template set<layout::effect::Slot>(slot);
+        }
+
+        constexpr std::uint8_t getSlot() const
+        {
+            return this->template get<layout::effect::Slot>();
+        }
+
+        constexpr void setModel(std::uint8_t model)
+        {
+            this->template set<layout::effect::Model>(model);
+        }
+
+        constexpr std::uint8_t getModel() const
+        {
+            return this->template get<layout::effect::Model>();
+        }
+
+        constexpr void setUnknown(std::uint8_t value0, std::uint8_t value1, std::uint8_t value2)
+        {
+            this->template set<layout::effect::Unknown0>(value0);
+            this->template set<layout::effect::Unknown1>(value1);
+            this->template set<layout::effect::Unknown2>(value2);
+        }
     };
 
+    using EffectPayload = BasicEffectPayload<>;
 
-    class AmpPayload : public PayloadBase
+
+    template <class Bytes = OwnedBytes<packetPayloadSize>>
+    class BasicAmpPayload : public PacketSection<packetPayloadSize, Bytes>
     {
     public:
-        void setModel(std::uint8_t value);
-        std::uint8_t getModel() const;
+        template <class Other>
+        using Rebind = BasicAmpPayload<Other>;
 
-        void setVolume(std::uint8_t value);
-        std::uint8_t getVolume() const;
+        using PacketSection<packetPayloadSize, Bytes>::PacketSection;
 
-        void setGain(std::uint8_t value);
-        std::uint8_t getGain() const;
+        constexpr void setModel(std::uint8_t value)
+        {
+            this->template set<layout::amp::Model>(value);
+        }
 
-        void setGain2(std::uint8_t value);
-        std::uint8_t getGain2() const;
+        constexpr std::uint8_t getModel() const
+        {
+            return this->template get<layout::amp::Model>();
+        }
 
-        void setMasterVolume(std::uint8_t value);
-        std::uint8_t getMasterVolume() const;
+        constexpr void setVolume(std::uint8_t value)
+        {
+            this->template set<layout::amp::Volume>(value);
+        }
 
-        void setTreble(std::uint8_t value);
-        std::uint8_t getTreble() const;
+        constexpr std::uint8_t getVolume() const
+        {
+            return this->template get<layout::amp::Volume>();
+        }
 
-        void setMiddle(std::uint8_t value);
-        std::uint8_t getMiddle() const;
+        constexpr void setGain(std::uint8_t value)
+        {
+            this->template set<layout::amp::Gain>(value);
+        }
 
-        void setBass(std::uint8_t value);
-        std::uint8_t getBass() const;
+        constexpr std::uint8_t getGain() const
+        {
+            return this->template get<layout::amp::Gain>();
+        }
+
+        constexpr void setGain2(std::uint8_t value)
+        {
+            this->template set<layout::amp::Gain2>(value);
+        }
 
-        void setPresence(std::uint8_t value);
-        std::uint8_t getPresence() const;
+        constexpr std::uint8_t getGain2() const
+        {
+            return this->template get<layout::amp::Gain2>();
+        }
 
-        void setDepth(std::uint8_t value);
-        std::uint8_t getDepth() const;
+        constexpr void setMasterVolume(std::uint8_t value)
+        {
+            this->template set<layout::amp::MasterVolume>(value);
+        }
 
-        void setBias(std::uint8_t value);
-        std::uint8_t getBias() const;
+        constexpr std::uint8_t getMasterVolume() const
+        {
+            return this->template get<layout::amp::MasterVolume>();
+        }
 
-        void setNoiseGate(std::uint8_t value);
-        std::uint8_t getNoiseGate() const;
+        constexpr void setTreble(std::uint8_t value)
+        {
+            this->template set<layout::amp::Treble>(value);
+        }
 
-        void setThreshold(std::uint8_t value);
-        std::uint8_t getThreshold() const;
+        constexpr std::uint8_t getTreble() const
+        {
+            return this->template get<layout::amp::Treble>();
+        }
 
-        void setCabinet(std::uint8_t value);
-        std::uint8_t getCabinet() const;
+        constexpr void setMiddle(std::uint8_t value)
+        {
+            this->template set<layout::amp::Middle>(value);
+        }
 
-        void setSag(std::uint8_t value);
-        std::uint8_t getSag() const;
+        constexpr std::uint8_t getMiddle() const
+        {
+            return this->template get<layout::amp::Middle>();
+        }
 
-        void setBrightness(std::uint8_t value);
-        std::uint8_t getBrightness() const;
+        constexpr void setBass(std::uint8_t value)
+        {
+            this->template set<layout::amp::Bass>(value);
+        }
 
-        void setUnknown(std::uint8_t value0, std::uint8_t value1, std::uint8_t value2);
-        void setUnknownAmpSpecific(std::uint8_t value0, std::uint8_t value1, std::uint8_t value2, std::uint8_t value3, std::uint8_t value4);
+        constexpr std::uint8_t getBass() const
+        {
+            return this->template get<layout::amp::Bass>();
+        }
 
-        void setUsbGain(std::uint8_t value);
-        std::uint8_t getUsbGain() const;
+        constexpr void setPresence(std::uint8_t value)
+        {
+            this->template set<layout::amp::Presence>(value);
+        }
+
+        constexpr std::uint8_t getPresence() const
+        {
+            return this->template get<layout::amp::Presence>();
+        }
+
+        constexpr void setDepth(std::uint8_t value)
+        {
+            this->template set<layout::amp::Depth>(value);
+        }
+
+        constexpr std::uint8_t getDepth() const
+        {
+            return this->template get<layout::amp::Depth>();
+        }
+
+        constexpr void setBias(std::uint8_t value)
+        {
+            this->template set<layout::amp::Bias>(value);
+        }
+
+        constexpr std::uint8_t getBias() const
+        {
+            return this->template get<layout::amp::Bias>();
+        }
+
+        constexpr void setNoiseGate(std::uint8_t value)
+        {
+            this->template set<layout::amp::NoiseGate>(value);
+        }
+
+        constexpr std::uint8_t getNoiseGate() const
+        {
+            return this->template get<layout::amp::NoiseGate>();
+        }
+
+        constexpr void setThreshold(std::uint8_t value)
+        {
+            this->template set<layout::amp::Threshold>(value);
+        }
+
+        constexpr std::uint8_t getThreshold() const
+        {
+            return this->template get<layout::amp::Threshold>();
+        }
+
+        constexpr void setCabinet(std::uint8_t value)
+        {
+            this->template set<layout::amp::Cabinet>(value);
+        }
+
+        constexpr std::uint8_t getCabinet() const
+        {
+            return this->template get<layout::amp::Cabinet>();
+        }
+
+        constexpr void setSag(std::uint8_t value)
+        {
+            this->template set<layout::amp::Sag>(value);
+        }
+
+        constexpr std::uint8_t getSag() const
+        {
+            return this->template get<layout::amp::Sag>();
+        }
+
+        constexpr void setBrightness(std::uint8_t value)
+        {
+            this->template set<layout::amp::Brightness>(value);
+        }
+
+        constexpr std::uint8_t getBrightness() const
+        {
+            return this->template get<layout::amp::Brightness>();
+        }
+
+        constexpr void setUnknown(std::uint8_t value0, std::uint8_t value1, std::uint8_t value2)
+        {
+            this->template set<layout::amp::Unknown0>(value0);
+            this->template set<layout::amp::Unknown1>(value1);
+            this->template set<layout::amp::Unknown2>(value2);
+        }
+
+        constexpr void setUnknownAmpSpecific(std::uint8_t value0, std::uint8_t value1, std::uint8_t value2, std::uint8_t value3, std::uint8_t value4)
+        {
+            this->template set<layout::amp::AmpSpecific0>(value0);
+            this->template set<layout::amp::AmpSpecific1>(value1);
+            this->template set<layout::amp::AmpSpecific2>(value2);
+            this->template set<layout::amp::AmpSpecific3>(value3);
+            this->template set<layout::amp::AmpSpecific4>(value4);
+        }
+
+        constexpr void setUsbGain(std::uint8_t value)
+        {
+            this->template set<layout::amp::UsbGain>(value);
+        }
+
+        constexpr std::uint8_t getUsbGain() const
+        {
+            return this->template get<layout::amp::UsbGain>();
+        }
     };
 
+    using AmpPayload = BasicAmpPayload<>;
+
+
+    using HeaderView = BasicHeader<ConstBytes<packetHeaderSize>>;
+
+    template <class Payload>
+    using PayloadView = typename Payload::template Rebind<ConstBytes<packetPayloadSize>>;
+
+    template <class Payload>
+    class Packet;
+
+
+    // Typed access to a packet in a raw buffer without copying it. Byte is
+    // const for reading and non-const for serializing into a send buffer; the
+    // buffer must outlive the view.
+    template <class Payload, class Byte>
+    class BasicPacketView
+    {
+    public:
+        using HeaderType = BasicHeader<std::span<Byte, packetHeaderSize>>;
+        using PayloadType = typename Payload::template Rebind<std::span<Byte, packetPayloadSize>>;
+
+        constexpr explicit BasicPacketView(std::span<Byte, packetRawTypeSize> data)
+            : bytes_(data)
+        {
+        }
+
+        constexpr BasicPacketView(const Packet<Payload>& packet)
+            requires std::is_const_v<Byte>
+            : bytes_(packet.bytes)
+        {
+        }
+
+        constexpr explicit BasicPacketView(Packet<Payload>& packet)
+            requires(!std::is_const_v<Byte>)
+            : bytes_(packet.bytes)
+        {
+        }
+
+        constexpr HeaderType getHeader() const
+        {
+            return HeaderType{bytes_.template first<packetHeaderSize>()};
+        }
+
+        constexpr PayloadType getPayload() const
+        {
+            return PayloadType{bytes_.template last<packetPayloadSize>()};
+        }
+
+        constexpr std::span<Byte, packetRawTypeSize> getBytes() const
+        {
+            return bytes_;
+        }
+
+    private:
+        std::span<Byte, packetRawTypeSize> bytes_;
+    };
+
+    template <class Payload>
+    using PacketView = BasicPacketView<Payload, const std::uint8_t>;
+
+    template <class Payload>
+    using MutablePacketView = BasicPacketView<Payload, std::uint8_t>;
 
-    constexpr std::size_t packetRawTypeSize = 64;
-    using PacketRawType = std::array<std::uint8_t, packetRawTypeSize>;
 
     template <class Payload>
     class Packet
@@ -209,62 +802,61 @@ namespace plug::com
     public:
         using RawType = PacketRawType;
 
-        Packet(const Header& h, const Payload& p)
-            : header(h), payload(p)
+        constexpr Packet(const Header& h, const Payload& p)
+            : bytes{}
         {
+            setHeader(h);
+            setPayload(p);
         }
 
-        Packet()
+        constexpr Packet()
+            : bytes{}
         {
         }
 
-        void setHeader(const Header& h)
+        constexpr explicit Packet(PacketView<Payload> view)
+            : bytes{}
         {
-            header = h;
+            std::copy(view.getBytes().begin(), view.getBytes().end(), bytes.begin());
         }
 
-        const Header& getHeader() const
+        constexpr void setHeader(const Header& h)
         {
-            return header;
+            const auto data = h.getBytes();
+            std::copy(data.cbegin(), data.cend(), bytes.begin());
         }
 
-        void setPayload(const Payload& p)
+        constexpr HeaderView getHeader() const
         {
-            payload = p;
+            return PacketView<Payload>{*this}.getHeader();
         }
 
-        const Payload& getPayload() const
+        constexpr void setPayload(const Payload& p)
         {
-            return payload;
+            const auto data = p.getBytes();
+            std::copy(data.cbegin(), data.cend(), std::next(bytes.begin(), packetHeaderSize));
         }
 
-        RawType getBytes() const
+        constexpr PayloadView<Payload> getPayload() const
         {
-            RawType bytes{{}};
-            const auto headerBytes = header.getBytes();
-            const auto payloadBytes = payload.getBytes();
-            const auto itr = std::copy(headerBytes.cbegin(), headerBytes.cend(), bytes.begin());
-            std::copy(payloadBytes.cbegin(), payloadBytes.cend(), itr);
+            return PacketView<Payload>{*this}.getPayload();
+        }
 
+        constexpr const RawType& getBytes() const
+        {
             return bytes;
         }
 
-        void fromBytes(const RawType& data)
+        constexpr void fromBytes(const RawType& data)
         {
-            typename Header::RawType headerData{{}};
-            const auto startOfPayload = std::next(data.cbegin(), headerData.size());
-            std::copy(data.cbegin(), startOfPayload, headerData.begin());
-            header.fromBytes(headerData);
-
-            typename Payload::RawType payloadData{{}};
-            std::copy(startOfPayload, data.cend(), payloadData.begin());
-            payload.fromBytes(payloadData);
+            bytes = data;
         }
 
-
     private:
-        Header header;
-        Payload payload;
+        friend class BasicPacketView<Payload, const std::uint8_t>;
+        friend class BasicPacketView<Payload, std::uint8_t>;
+
+        RawType bytes;
     };
 
 }
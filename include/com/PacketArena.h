@@ -0,0 +1,82 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "com/Packet.h"
+#include <span>
+#include <vector>
+#include <cstdint>
+
+namespace plug::com
+{
+    // Preallocated storage for a stream of raw packets. Packets are received in
+    // place, so filling the arena up to its capacity does not allocate.
+    class PacketArena
+    {
+    public:
+        explicit PacketArena(std::size_t capacity)
+        {
+            packets_.reserve(capacity);
+        }
+
+        PacketRawType& allocate()
+        {
+            return packets_.emplace_back();
+        }
+
+        void reset() noexcept
+        {
+            packets_.clear();
+        }
+
+        std::size_t size() const noexcept
+        {
+            return packets_.size();
+        }
+
+        std::size_t capacity() const noexcept
+        {
+            return packets_.capacity();
+        }
+
+        const PacketRawType& operator[](std::size_t index) const
+        {
+            return packets_[index];
+        }
+
+        std::span<const PacketRawType> packets(std::size_t first, std::size_t count) const
+        {
+            return std::span{packets_}.subspan(first, count);
+        }
+
+        auto begin() const noexcept
+        {
+            return packets_.cbegin();
+        }
+
+        auto end() const noexcept
+        {
+            return packets_.cend();
+        }
+
+    private:
+        std::vector<PacketRawType> packets_;
+    };
+}
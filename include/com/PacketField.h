@@ -0,0 +1,118 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <array>
+#include <algorithm>
+#include <type_traits>
+#include <cstdint>
+
+namespace plug::com
+{
+    // Location of a value within a packet section. Settings mapped onto a
+    // single byte field are clamped to [0, Max] on the way out.
+    template <std::size_t Offset, std::size_t Width = 1, std::uint8_t Max = 0xff>
+    struct PacketField
+    {
+        static_assert(Width > 0, "Field must have at least one byte");
+
+        static constexpr std::size_t offset{Offset};
+        static constexpr std::size_t width{Width};
+        static constexpr std::uint8_t max{Max};
+
+        static constexpr std::uint8_t clamp(std::uint8_t value)
+        {
+            return std::min(value, Max);
+        }
+    };
+
+
+    // All fields of a section; a layout is valid if every field fits into
+    // the section and no two fields share a byte.
+    template <class... Fields>
+    struct FieldLayout
+    {
+        template <std::size_t N>
+        static constexpr bool fitsInto()
+        {
+            std::array<bool, N> used{};
+            bool valid{true};
+
+            auto place = [&used, &valid](std::size_t offset, std::size_t width)
+            {
+                if ((offset + width) > N)
+                {
+                    valid = false;
+                    return;
+                }
+
+                for (std::size_t i = offset; i < offset + width; ++i)
+                {
+                    valid = valid && !used[i];
+                    used[i] = true;
+                }
+            };
+
+            (place(Fields::offset, Fields::width), ...);
+            return valid;
+        }
+    };
+
+
+    // Binds a single byte field to a member of a settings struct
+    template <class F, auto Member>
+    struct FieldMapping
+    {
+        static_assert(F::width == 1, "Only single byte fields can be mapped");
+
+        template <class Struct, class Section>
+        static constexpr void encode(const Struct& from, Section& to)
+        {
+            to.template set<F>(F::clamp(static_cast<std::uint8_t>(from.*Member)));
+        }
+
+        template <class Section, class Struct>
+        static constexpr void decode(const Section& from, Struct& to)
+        {
+            using Value = std::remove_cvref_t<decltype(to.*Member)>;
+            to.*Member = static_cast<Value>(from.template get<F>());
+        }
+    };
+
+
+    // Copies a group of fields between a settings struct and a section, each
+    // mapping expands to a single byte move
+    template <class... Mappings>
+    struct StructMapping
+    {
+        template <class Struct, class Section>
+        static constexpr void encode(const Struct& from, Section& to)
+        {
+            (Mappings::encode(from, to), ...);
+        }
+
+        template <class Section, class Struct>
+        static constexpr void decode(const Section& from, Struct& to)
+        {
+            (Mappings::decode(from, to), ...);
+        }
+    };
+}
@@ -24,6 +24,7 @@
 #include "data_structs.h"
 #include "effects_enum.h"
 #include "com/Packet.h"
+#include <optional>
 #include <string>
 #include <vector>
 #include <array>
@@ -32,32 +33,106 @@
 namespace plug::com
 {
     template <class T>
-    Packet<T> fromRawData(const std::array<std::uint8_t, 64>& data)
+    constexpr Packet<T> fromRawData(const std::array<std::uint8_t, 64>& data)
     {
         Packet<T> packet{};
         packet.fromBytes(data);
         return packet;
     }
 
-    std::string decodeNameFromData(const Packet<NamePayload>& packet);
-    amp_settings decodeAmpFromData(const Packet<AmpPayload>& packet, const Packet<AmpPayload>& packetUsbGain);
+    DSP dspFromEffect(effects effect);
 
+    // Clearing a DSP doesn't depend on the model, any effect of the family will do
+    inline constexpr std::array<effects, 4> dspClearEffects{{effects::OVERDRIVE, effects::SINE_CHORUS,
+                                                             effects::MONO_DELAY, effects::SMALL_HALL_REVERB}};
+
+    std::string decodeNameFromData(PacketView<NamePayload> packet);
+    amp_settings decodeAmpFromData(PacketView<AmpPayload> packet, PacketView<AmpPayload> packetUsbGain);
+
+    // Like decodeAmpFromData() and decodeEffectFromData(), but without
+    // exceptions; returns std::nullopt on unknown model ids
+    std::optional<amp_settings> tryDecodeAmpFromData(PacketView<AmpPayload> packet, PacketView<AmpPayload> packetUsbGain);
+    std::optional<fx_pedal_settings> tryDecodeEffectFromData(PacketView<EffectPayload> packet);
+
+    fx_pedal_settings decodeEffectFromData(PacketView<EffectPayload> packet);
     std::vector<fx_pedal_settings> decodeEffectsFromData(const std::array<Packet<EffectPayload>, 4>& packet);
-    std::vector<std::string> decodePresetListFromData(const std::vector<Packet<NamePayload>>& packet);
 
     Packet<AmpPayload> serializeAmpSettings(const amp_settings& value);
     Packet<AmpPayload> serializeAmpSettingsUsbGain(const amp_settings& value);
     Packet<NamePayload> serializeName(std::uint8_t slot, std::string_view name);
     Packet<EffectPayload> serializeEffectSettings(const fx_pedal_settings& value);
     Packet<EffectPayload> serializeClearEffectSettings(fx_pedal_settings effect);
+
+    // Serialize straight into a send buffer, overwriting all of it
+    void serializeAmpSettings(const amp_settings& value, MutablePacketView<AmpPayload> out);
+    void serializeAmpSettingsUsbGain(const amp_settings& value, MutablePacketView<AmpPayload> out);
+    void serializeEffectSettings(const fx_pedal_settings& value, MutablePacketView<EffectPayload> out);
+    void serializeClearEffectSettings(fx_pedal_settings effect, MutablePacketView<EffectPayload> out);
     Packet<NamePayload> serializeSaveEffectName(std::uint8_t slot, std::string_view name, const std::vector<fx_pedal_settings>& effects);
     std::vector<Packet<EffectPayload>> serializeSaveEffectPacket(std::uint8_t slot, const std::vector<fx_pedal_settings>& effects);
 
-    Packet<EmptyPayload> serializeLoadSlotCommand(std::uint8_t slot);
-    Packet<EmptyPayload> serializeLoadCommand();
-    Packet<EmptyPayload> serializeApplyCommand();
+    constexpr PacketRawType serializeCommandBytes(Stage stage, Type type, DSP dsp)
+    {
+        Header header{};
+        header.setStage(stage);
+        header.setType(type);
+        header.setDSP(dsp);
+        return Packet<EmptyPayload>{header, EmptyPayload{}}.getBytes();
+    }
+
+    constexpr PacketRawType serializeLoadSlotCommandBytes(std::uint8_t slot)
+    {
+        Header header{};
+        header.setStage(Stage::ready);
+        header.setType(Type::operation);
+        header.setDSP(DSP::opSelectMemBank);
+        header.setSlot(slot);
+        header.setUnknown(0x00, 0x01, 0x00);
+        return Packet<EmptyPayload>{header, EmptyPayload{}}.getBytes();
+    }
+
+    // The command packets never change, they are built once at compile time
+    inline constexpr std::array<PacketRawType, 2> initCommandPackets{{serializeCommandBytes(Stage::init0, Type::init0, DSP::none),
+                                                                      serializeCommandBytes(Stage::init1, Type::init1, DSP::none)}};
+    inline constexpr PacketRawType loadCommandPacket{serializeCommandBytes(Stage::unknown, Type::load, DSP::none)};
+    inline constexpr PacketRawType applyCommandPacket{serializeCommandBytes(Stage::ready, Type::data, DSP::none)};
+
+    inline constexpr std::size_t loadSlotCommandCount{100};
+    inline constexpr std::array<PacketRawType, loadSlotCommandCount> loadSlotCommandPackets = []
+    {
+        std::array<PacketRawType, loadSlotCommandCount> packets{};
+
+        for (std::size_t slot = 0; slot < packets.size(); ++slot)
+        {
+            packets[slot] = serializeLoadSlotCommandBytes(static_cast<std::uint8_t>(slot));
+        }
+        return packets;
+    }();
+
+    constexpr Packet<EmptyPayload> serializeLoadSlotCommand(std::uint8_t slot)
+    {
+        if (slot < loadSlotCommandPackets.size())
+        {
+            return fromRawData<EmptyPayload>(loadSlotCommandPackets[slot]);
+        }
+        return fromRawData<EmptyPayload>(serializeLoadSlotCommandBytes(slot));
+    }
+
+    constexpr Packet<EmptyPayload> serializeLoadCommand()
+    {
+        return fromRawData<EmptyPayload>(loadCommandPacket);
+    }
+
+    constexpr Packet<EmptyPayload> serializeApplyCommand()
+    {
+        return fromRawData<EmptyPayload>(applyCommandPacket);
+    }
+
     Packet<EmptyPayload> serializeApplyCommand(fx_pedal_settings effect);
 
-    std::array<Packet<EmptyPayload>, 2> serializeInitCommand();
+    constexpr std::array<Packet<EmptyPayload>, 2> serializeInitCommand()
+    {
+        return {{fromRawData<EmptyPayload>(initCommandPackets[0]), fromRawData<EmptyPayload>(initCommandPackets[1])}};
+    }
 
 }
@@ -0,0 +1,79 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "SignalChain.h"
+#include <filesystem>
+#include <iosfwd>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace plug::com
+{
+    struct DeviceIdentity
+    {
+        std::uint16_t vendorId;
+        std::uint16_t productId;
+        std::string name;
+        // Where the amp is plugged in; tells apart amps of the same model, but
+        // isn't part of the comparison since it changes with the port
+        std::string location;
+    };
+
+    bool operator==(const DeviceIdentity& lhs, const DeviceIdentity& rhs);
+
+
+    // Preset names and decoded banks last seen on a device, so they can be shown
+    // before (or without) streaming them from the amp again.
+    class PresetCache
+    {
+    public:
+        explicit PresetCache(DeviceIdentity device);
+
+        const DeviceIdentity& device() const;
+
+        const std::vector<std::string>& presetNames() const;
+
+        // Updates the names; banks whose name changed are dropped as outdated.
+        // Returns true if anything changed.
+        bool setPresetNames(const std::vector<std::string>& names);
+
+        std::optional<SignalChain> bank(std::size_t slot) const;
+        bool setBank(std::size_t slot, const SignalChain& signalChain);
+
+        std::string fileName() const;
+
+        void write(std::ostream& stream) const;
+        static std::optional<PresetCache> read(std::istream& stream, const DeviceIdentity& device);
+
+    private:
+        DeviceIdentity device_;
+        std::vector<std::string> presetNames_;
+        std::map<std::size_t, SignalChain> banks_;
+    };
+
+
+    std::optional<PresetCache> loadPresetCache(const std::filesystem::path& directory, const DeviceIdentity& device);
+    bool savePresetCache(const std::filesystem::path& directory, const PresetCache& cache);
+}
@@ -21,6 +21,7 @@
 #pragma once
 
 #include "com/Connection.h"
+#include <com/UsbContext.h>
 #include <com/UsbDevice.h>
 
 
@@ -35,14 +36,22 @@ namespace plug::com
         void close() override;
         bool isOpen() const override;
 
+        using Connection::receive;
         std::vector<std::uint8_t> receive(std::size_t recvSize) override;
+        using Connection::receiveAsync;
+        std::future<std::vector<std::uint8_t>> receiveAsync(std::size_t recvSize) override;
 
         std::string name() const override;
 
     private:
-        std::size_t sendImpl(std::uint8_t* data, std::size_t size) override;
+        std::size_t sendImpl(const std::uint8_t* data, std::size_t size) override;
+        std::size_t receiveImpl(std::uint8_t* data, std::size_t size) override;
+        std::future<std::size_t> receiveAsyncImpl(std::uint8_t* data, std::size_t size) override;
 
+        // The event loop completes the transfers of the device, so it's
+        // stopped before the device is closed
         usb::Device device_;
+        usb::EventLoop events_;
         const std::string name_;
     };
 }
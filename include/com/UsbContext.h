@@ -21,10 +21,17 @@
 #pragma once
 
 #include <com/UsbDevice.h>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <thread>
 #include <vector>
+#include <cstdint>
 
 namespace plug::com::usb
 {
+    // Owns a libusb session of its own; devices, event loops and hotplug
+    // registrations created from it keep it alive.
     class Context
     {
     public:
@@ -34,11 +41,71 @@ namespace plug::com::usb
 
         Context& operator=(const Context&) = delete;
 
+        libusb_context* get() const noexcept;
+
     private:
         void init();
         void deinit();
+
+        libusb_context* context_;
+    };
+
+
+    // Dispatches completions of asynchronous transfers on a dedicated thread.
+    class EventLoop
+    {
+    public:
+        explicit EventLoop(std::shared_ptr<Context> context);
+        EventLoop(const EventLoop&) = delete;
+        ~EventLoop();
+
+        EventLoop& operator=(const EventLoop&) = delete;
+
+    private:
+        void run();
+
+        std::shared_ptr<Context> context_;
+        std::atomic<bool> running_;
+        std::thread thread_;
+    };
+
+
+    // Reports devices of the vendor and products as they are plugged in or
+    // removed; devices already present are reported as arrived. Those are
+    // reported synchronously by the constructor, on the constructing thread;
+    // later changes are reported on the event thread. The handler must not
+    // open the device in either case.
+    class Hotplug
+    {
+    public:
+        enum class Event
+        {
+            arrived,
+            left
+        };
+
+        using Handler = std::function<void(Event, Device)>;
+
+        Hotplug(std::shared_ptr<Context> context, std::uint16_t vendorId, const std::vector<std::uint16_t>& productIds, Handler handler);
+        Hotplug(const Hotplug&) = delete;
+        ~Hotplug();
+
+        Hotplug& operator=(const Hotplug&) = delete;
+
+    private:
+        using Dispatch = std::function<void(Event, libusb_device*)>;
+
+        void deregister();
+
+        std::shared_ptr<Context> context_;
+        Handler handler_;
+        Dispatch dispatch_;
+        std::vector<int> handles_;
+        EventLoop events_;
     };
 
-    std::vector<Device> listDevices();
+
+    bool hasHotplug();
+    std::vector<Device> listDevices(std::shared_ptr<Context> context);
 
 }
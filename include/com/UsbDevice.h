@@ -23,13 +23,19 @@
 #include <string>
 #include <vector>
 #include <cstdint>
+#include <future>
 #include <memory>
 
+struct libusb_context;
 struct libusb_device;
 struct libusb_device_handle;
+struct libusb_transfer;
 
 namespace plug::com::usb
 {
+    class Context;
+
+
     template <auto Fn>
     struct ReleaseFunction
     {
@@ -48,13 +54,15 @@ namespace plug::com::usb
     {
         void releaseDevice(libusb_device* device);
         void releaseHandle(libusb_device_handle* handle);
+        void releaseTransfer(libusb_transfer* transfer);
     }
 
 
     class Device
     {
     public:
-        explicit Device(libusb_device* device);
+        // The device keeps the context it belongs to alive
+        Device(libusb_device* device, std::shared_ptr<Context> context);
         Device(Device&&) = default;
 
         void open();
@@ -64,9 +72,21 @@ namespace plug::com::usb
         std::uint16_t vendorId() const noexcept;
         std::uint16_t productId() const noexcept;
         std::string name() const;
+        // Bus number and port path ("1-2.3"); unlike the name it's readable
+        // without opening the device, even after it has left
+        std::string location() const;
+        std::shared_ptr<Context> context() const;
 
-        std::size_t write(std::uint8_t endpoint, std::uint8_t* data, std::size_t dataSize);
+        std::size_t write(std::uint8_t endpoint, const std::uint8_t* data, std::size_t dataSize);
         std::vector<std::uint8_t> receive(std::uint8_t endpoint, std::size_t dataSize);
+        std::size_t receive(std::uint8_t endpoint, std::uint8_t* data, std::size_t dataSize);
+
+        // Submit the transfer and return immediately; completion requires a
+        // running EventLoop. Pending transfers must finish before close().
+        std::future<std::size_t> writeAsync(std::uint8_t endpoint, const std::uint8_t* data, std::size_t dataSize);
+        std::future<std::vector<std::uint8_t>> receiveAsync(std::uint8_t endpoint, std::size_t dataSize);
+        // Receives into data, which must stay valid until the transfer is completed
+        std::future<std::size_t> receiveAsync(std::uint8_t endpoint, std::uint8_t* data, std::size_t dataSize);
 
         Device& operator=(Device&&) = default;
 
@@ -81,6 +101,7 @@ namespace plug::com::usb
 
         Descriptor getDeviceDescriptor(libusb_device* device) const;
 
+        std::shared_ptr<Context> context_;
         Ressource<libusb_device, detail::releaseDevice> device_;
         Ressource<libusb_device_handle, detail::releaseHandle> handle_;
         Descriptor descriptor_;
@@ -21,6 +21,7 @@
 
 #pragma once
 
+#include "data_structs.h"
 #include <QDialog>
 #include <QSettings>
 #include <memory>
@@ -44,6 +45,8 @@ namespace plug
 
         Amp_Advanced& operator=(const Amp_Advanced&) = delete;
 
+        void load(const amp_settings& settings);
+
     public slots:
         void change_cabinet(int);
         void change_noise_gate(int);
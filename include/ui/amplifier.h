@@ -24,6 +24,7 @@
 #include "data_structs.h"
 #include "effects_enum.h"
 #include "DeviceModel.h"
+#include "ui/edit_tracker.h"
 #include <QMainWindow>
 #include <memory>
 
@@ -60,7 +61,8 @@ namespace plug
         unsigned char gain, volume, treble, middle, bass;
         cabinets cabinet;
         unsigned char noise_gate, presence, gain2, master_vol, threshold, depth, bias, sag, usb_gain;
-        bool changed, brightness;
+        bool brightness;
+        EditTracker edits;
 
     public slots:
         // set basic variables
@@ -86,7 +88,9 @@ namespace plug
 
         // send settings to the amplifier
         void send_amp();
+        void send_live();
 
+        // update the widgets without sending the settings to the amplifier
         void load(amp_settings);
         void get_settings(amp_settings*);
         void enable_set_button(bool);
@@ -0,0 +1,81 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <utility>
+
+namespace plug
+{
+    // Tracks whether a settings window holds edits that still have to be sent
+    // to the amplifier. Widget changes made while populating it from the amp
+    // or a file aren't edits, so the just-read settings aren't written back.
+    class EditTracker
+    {
+    public:
+        void setChanged(bool value) noexcept
+        {
+            if (!populating_ || !value)
+            {
+                changed_ = value;
+            }
+        }
+
+        bool changed() const noexcept
+        {
+            return changed_;
+        }
+
+        // Returns whether there are edits to send, they count as sent afterwards
+        bool takeChanges() noexcept
+        {
+            return std::exchange(changed_, false);
+        }
+
+        bool populating() const noexcept
+        {
+            return populating_;
+        }
+
+        // Runs the widget updates; afterwards the window matches the settings
+        template <class Update>
+        void populate(Update&& update)
+        {
+            struct Guard
+            {
+                EditTracker& tracker;
+
+                ~Guard()
+                {
+                    tracker.populating_ = false;
+                    tracker.changed_ = false;
+                }
+            };
+
+            populating_ = true;
+            const Guard guard{*this};
+            std::forward<Update>(update)();
+        }
+
+    private:
+        bool changed_{false};
+        bool populating_{false};
+    };
+}
@@ -24,6 +24,7 @@
 #include "data_structs.h"
 #include "effects_enum.h"
 #include "FxSlot.h"
+#include "ui/edit_tracker.h"
 #include <QMainWindow>
 #include <memory>
 
@@ -46,6 +47,7 @@ namespace plug
 
         void set_changed(bool);
         bool get_changed() const;
+        bool is_populating() const;
 
         fx_pedal_settings getSettings() const;
 
@@ -65,7 +67,7 @@ namespace plug
         unsigned char knob5;
         unsigned char knob6;
         bool enabled;
-        bool changed;
+        EditTracker edits;
         QString temp1;
         QString temp2;
 
@@ -83,7 +85,9 @@ namespace plug
 
         // send settings to the amplifier
         void send_fx();
+        void send_live();
 
+        // update the widgets without sending the settings to the amplifier
         void load(fx_pedal_settings);
         void load_default_fx();
 
@@ -0,0 +1,66 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "effects_enum.h"
+#include <QString>
+#include <array>
+
+class QDial;
+class QLabel;
+class QSpinBox;
+
+namespace plug
+{
+    // The widgets of one effect knob
+    struct KnobWidgets
+    {
+        QLabel* label;
+        QDial* dial;
+        QSpinBox* spinBox;
+    };
+
+    using EffectKnobWidgets = std::array<KnobWidgets, 6>;
+
+    struct KnobTexts
+    {
+        QString label;
+        QString dialName;
+        QString dialDescription;
+        QString spinBoxName;
+        QString spinBoxDescription;
+    };
+
+    // Texts that differ between the effect windows. The dial and box names of
+    // a used knob take the knob name as their last argument.
+    struct KnobTextFormat
+    {
+        QString dialName;
+        QString spinBoxName;
+        std::array<KnobTexts, 6> empty;
+    };
+
+    // Sets range, state and texts of the knobs for the effect, knobs the
+    // effect doesn't use are disabled and reset to zero if resetUnused is set
+    void showEffectKnobs(const EffectKnobWidgets& widgets, effects effect, const KnobTextFormat& format, bool resetUnused);
+
+    void enableEffectKnobs(const EffectKnobWidgets& widgets, effects effect);
+}
@@ -43,6 +43,7 @@ namespace plug
         ~LoadFromAmp() override;
 
         void load_names(const std::vector<std::string>& names);
+        void add_name(std::size_t index, const std::string& name);
         void delete_items();
         void change_name(int, QString*);
 
@@ -22,9 +22,15 @@
 #pragma once
 
 #include "data_structs.h"
+#include "com/AmpEvent.h"
+#include "com/PresetCache.h"
+#include "com/UsbContext.h"
 #include <QMainWindow>
 #include <array>
+#include <future>
 #include <memory>
+#include <optional>
+#include <vector>
 
 namespace Ui
 {
@@ -45,6 +51,10 @@ namespace plug
     namespace com
     {
         class Mustang;
+        class AsyncMustang;
+        class LiveUpdater;
+        struct LiveStats;
+        struct UpdateProgress;
     }
 }
 
@@ -68,6 +78,8 @@ namespace plug
         void stop_amp();
         void set_effect(fx_pedal_settings);
         void set_amplifier(amp_settings);
+        void set_effect_live(fx_pedal_settings);
+        void set_amplifier_live(amp_settings);
         void save_on_amp(char*, int);
         void load_from_amp(int);
         void enable_buttons();
@@ -81,12 +93,45 @@ namespace plug
         void empty_other(int, Effect*);
 
     private:
+        void send_loaded_settings(const std::vector<fx_pedal_settings>& loadedEffects);
+        void restore_preset_cache();
+        void show_cached_presets();
+        void update_preset_cache(const std::vector<std::string>& names);
+        void show_signal_chain(const SignalChain& signalChain);
+        void add_preset_name(std::size_t index, const std::string& presetName);
+        void show_current_preset(const SignalChain& signalChain);
+        void show_error(const QString& message);
+        void start_live_updates();
+        void show_live_stats(const com::LiveStats& stats);
+        void show_amp_event(const com::AmpEvent& ampEvent);
+        void connect_amp(std::shared_ptr<com::usb::Device> device);
+        void show_disconnected(const QString& message);
+        void watch_amps();
+        void amp_plugged(com::usb::Hotplug::Event event, std::shared_ptr<com::usb::Device> device);
+        bool is_current_amp(const com::usb::Device& device) const;
+        void amp_lost();
+        void release_amp();
+        void release(std::unique_ptr<com::LiveUpdater> updater, std::unique_ptr<com::AsyncMustang> device);
+        void restore_signal_chain();
+        void show_update_progress(const com::UpdateProgress& progress);
+        void firmware_updated(int result);
+
+        template <class Command, class Done>
+        void run_on_amp(Command command, Done done);
+
         const std::unique_ptr<Ui::MainWindow> ui;
 
         QString current_name;
         std::vector<std::string> presetNames;
         bool connected;
-        std::unique_ptr<com::Mustang> amp_ops;
+        std::unique_ptr<com::AsyncMustang> amp_ops;
+        std::size_t ampSession;
+        std::vector<std::shared_future<void>> ampReleases;
+        std::unique_ptr<com::LiveUpdater> liveUpdater;
+        std::unique_ptr<com::usb::Hotplug> hotplug;
+        std::optional<SignalChain> lostSignalChain;
+        com::DeviceIdentity lostAmpIdentity;
+        std::optional<com::PresetCache> presetCache;
         Amplifier* amp;
         std::array<Effect*, 8> effectComponents;
         SaveOnAmp* save;
@@ -95,6 +140,7 @@ namespace plug
         Settings* settings_win;
         SaveToFile* saver;
         QuickPresets* quickpres;
+        std::future<void> firmwareUpdate;
 
     private slots:
         void about();
@@ -19,7 +19,6 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#include "com/UsbContext.h"
 #include "com/Mustang.h"
 #include "ui/mainwindow.h"
 #include "Version.h"
@@ -32,8 +31,6 @@ int main(int argc, char* argv[])
     QCoreApplication::setApplicationName("Plug");
     QCoreApplication::setApplicationVersion(QString::fromStdString(plug::version()));
 
-    plug::com::usb::Context context{};
-
     plug::MainWindow window;
     window.show();
 
@@ -0,0 +1,55 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "com/AmpRegistry.h"
+
+namespace plug::com
+{
+    AmpRegistry::AmpRegistry(std::vector<std::unique_ptr<Mustang>> devices)
+    {
+        amps.reserve(devices.size());
+        std::transform(devices.begin(), devices.end(), std::back_inserter(amps), [](auto& device)
+                       { return std::make_unique<AsyncMustang>(std::move(device)); });
+    }
+
+    std::size_t AmpRegistry::size() const noexcept
+    {
+        return amps.size();
+    }
+
+    bool AmpRegistry::empty() const noexcept
+    {
+        return amps.empty();
+    }
+
+    AsyncMustang& AmpRegistry::at(std::size_t index)
+    {
+        return *amps.at(index);
+    }
+
+    std::vector<DeviceIdentity> AmpRegistry::identities() const
+    {
+        std::vector<DeviceIdentity> result;
+        result.reserve(amps.size());
+        std::transform(amps.cbegin(), amps.cend(), std::back_inserter(result), [](const auto& amp)
+                       { return amp->getDeviceIdentity(); });
+        return result;
+    }
+}
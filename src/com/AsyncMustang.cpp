@@ -0,0 +1,99 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "com/AsyncMustang.h"
+
+namespace plug::com
+{
+    AsyncMustang::AsyncMustang(std::unique_ptr<Mustang> device)
+        : mustang(std::move(device)), model(mustang->getDeviceModel()), identity(mustang->getDeviceIdentity())
+    {
+    }
+
+    std::future<InitialData> AsyncMustang::start_amp(StartObserver observer)
+    {
+        return run([observer = std::move(observer)](Mustang& device)
+                   { return device.start_amp(observer); });
+    }
+
+    std::future<void> AsyncMustang::stop_amp()
+    {
+        return run([](Mustang& device)
+                   { device.stop_amp(); });
+    }
+
+    std::future<void> AsyncMustang::set_effect(fx_pedal_settings value)
+    {
+        return run([value](Mustang& device)
+                   { device.set_effect(value); });
+    }
+
+    std::future<void> AsyncMustang::set_amplifier(amp_settings value)
+    {
+        return run([value](Mustang& device)
+                   { device.set_amplifier(value); });
+    }
+
+    std::future<void> AsyncMustang::commit(CommandBatch batch)
+    {
+        return run([batch = std::move(batch)](Mustang& device)
+                   { device.commit(batch); });
+    }
+
+    std::future<std::size_t> AsyncMustang::apply(SignalChain chain)
+    {
+        return run([chain = std::move(chain)](Mustang& device)
+                   { return device.apply(chain); });
+    }
+
+    std::future<void> AsyncMustang::save_on_amp(std::string name, std::uint8_t slot)
+    {
+        return run([name = std::move(name), slot](Mustang& device)
+                   { device.save_on_amp(name, slot); });
+    }
+
+    std::future<SignalChain> AsyncMustang::load_memory_bank(std::uint8_t slot)
+    {
+        return run([slot](Mustang& device)
+                   { return device.load_memory_bank(slot); });
+    }
+
+    std::future<void> AsyncMustang::save_effects(std::uint8_t slot, std::string name, std::vector<fx_pedal_settings> effects)
+    {
+        return run([slot, name = std::move(name), effects = std::move(effects)](Mustang& device)
+                   { device.save_effects(slot, name, effects); });
+    }
+
+    std::future<void> AsyncMustang::track(AmpEvent ampEvent)
+    {
+        return run([ampEvent = std::move(ampEvent)](Mustang& device)
+                   { device.track(ampEvent); });
+    }
+
+    DeviceModel AsyncMustang::getDeviceModel() const
+    {
+        return model;
+    }
+
+    DeviceIdentity AsyncMustang::getDeviceIdentity() const
+    {
+        return identity;
+    }
+}
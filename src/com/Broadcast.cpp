@@ -0,0 +1,76 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "com/Broadcast.h"
+#include "com/CommandBatch.h"
+#include <algorithm>
+#include <future>
+#include <latch>
+
+namespace plug::com
+{
+    BroadcastStats broadcast(AmpRegistry& registry, const SignalChain& chain)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        CommandBatch batch;
+        batch.set_signal_chain(chain);
+
+        std::latch ready{static_cast<std::ptrdiff_t>(registry.size())};
+        std::promise<Clock::time_point> start;
+        const auto started = start.get_future().share();
+
+        // Every worker waits at the start line, so none gets a head start
+        auto results = registry.runAll([&batch, &ready, started](Mustang& device)
+                                       {
+            ready.count_down();
+            const auto since = started.get();
+            device.commit(batch);
+            return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - since); });
+
+        ready.wait();
+        start.set_value(Clock::now());
+
+        BroadcastStats stats{{}, batch.size() + 1, std::chrono::microseconds::max(), std::chrono::microseconds{0}, std::chrono::microseconds{0}};
+        stats.amps.reserve(results.size());
+
+        for (auto& result : results)
+        {
+            try
+            {
+                const auto latency = result.get();
+                stats.amps.push_back(AmpBroadcastResult{latency, std::nullopt});
+                stats.fastest = std::min(stats.fastest, latency);
+                stats.slowest = std::max(stats.slowest, latency);
+            }
+            catch (const std::exception& ex)
+            {
+                stats.amps.push_back(AmpBroadcastResult{std::chrono::microseconds{0}, ex.what()});
+            }
+        }
+
+        if (stats.fastest > stats.slowest)
+        {
+            stats.fastest = std::chrono::microseconds{0};
+        }
+        stats.spread = stats.slowest - stats.fastest;
+        return stats;
+    }
+}
@@ -0,0 +1,104 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "com/CommandBatch.h"
+#include "com/PacketSerializer.h"
+#include <algorithm>
+
+namespace plug::com
+{
+    void CommandBatch::set_amplifier(amp_settings value)
+    {
+        serializeAmpSettings(value, MutablePacketView<AmpPayload>{packets_.emplace_back()});
+        serializeAmpSettingsUsbGain(value, MutablePacketView<AmpPayload>{packets_.emplace_back()});
+        amp_ = value;
+    }
+
+    void CommandBatch::set_effect(fx_pedal_settings value)
+    {
+        serializeClearEffectSettings(value, MutablePacketView<EffectPayload>{packets_.emplace_back()});
+
+        if ((value.enabled == true) && (value.effect_num != effects::EMPTY))
+        {
+            serializeEffectSettings(value, MutablePacketView<EffectPayload>{packets_.emplace_back()});
+        }
+        effects_.push_back(value);
+    }
+
+    void CommandBatch::set_signal_chain(const SignalChain& chain)
+    {
+        // The chain writes every DSP, so earlier writes would only be overwritten
+        packets_.clear();
+        serializeAmpSettings(chain.amp(), MutablePacketView<AmpPayload>{packets_.emplace_back()});
+        serializeAmpSettingsUsbGain(chain.amp(), MutablePacketView<AmpPayload>{packets_.emplace_back()});
+
+        const auto effects = chain.effects();
+
+        for (std::size_t i = 0; i < dspClearEffects.size(); ++i)
+        {
+            const auto dsp = static_cast<DSP>(static_cast<std::size_t>(DSP::effect0) + i);
+            const auto active = std::find_if(effects.cbegin(), effects.cend(), [dsp](const auto& effect)
+                                             { return effect.enabled && (dspFromEffect(effect.effect_num) == dsp); });
+
+            if (active != effects.cend())
+            {
+                serializeEffectSettings(*active, MutablePacketView<EffectPayload>{packets_.emplace_back()});
+            }
+            else
+            {
+                const fx_pedal_settings clear{FxSlot{0}, dspClearEffects[i], 0, 0, 0, 0, 0, 0, false};
+                serializeClearEffectSettings(clear, MutablePacketView<EffectPayload>{packets_.emplace_back()});
+            }
+        }
+        signalChain_ = chain;
+        amp_.reset();
+        effects_.clear();
+    }
+
+    bool CommandBatch::empty() const noexcept
+    {
+        return packets_.empty();
+    }
+
+    std::size_t CommandBatch::size() const noexcept
+    {
+        return packets_.size();
+    }
+
+    const std::vector<PacketRawType>& CommandBatch::packets() const noexcept
+    {
+        return packets_;
+    }
+
+    const std::optional<amp_settings>& CommandBatch::amplifier() const noexcept
+    {
+        return amp_;
+    }
+
+    const std::vector<fx_pedal_settings>& CommandBatch::effects() const noexcept
+    {
+        return effects_;
+    }
+
+    const std::optional<SignalChain>& CommandBatch::signalChain() const noexcept
+    {
+        return signalChain_;
+    }
+}
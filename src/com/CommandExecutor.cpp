@@ -0,0 +1,84 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "com/CommandExecutor.h"
+
+namespace plug::com
+{
+    CommandExecutor::CommandExecutor()
+        : pending_(0), wakeups_(0), running_(true), thread_([this]
+                                                         { run(); })
+    {
+    }
+
+    CommandExecutor::~CommandExecutor()
+    {
+        running_.store(false, std::memory_order_release);
+        wakeups_.fetch_add(1, std::memory_order_release);
+        wakeups_.notify_one();
+        thread_.join();
+    }
+
+    std::size_t CommandExecutor::pending() const
+    {
+        return pending_.load(std::memory_order_acquire);
+    }
+
+    bool CommandExecutor::isWorkerThread() const
+    {
+        return std::this_thread::get_id() == thread_.get_id();
+    }
+
+    void CommandExecutor::enqueue(std::function<void()> command)
+    {
+        // Counted before it's queued, so the worker never sees more commands than pending
+        pending_.fetch_add(1, std::memory_order_acq_rel);
+        queue_.push(std::move(command));
+        wakeups_.fetch_add(1, std::memory_order_release);
+        wakeups_.notify_one();
+    }
+
+    void CommandExecutor::run()
+    {
+        while (true)
+        {
+            const auto seen = wakeups_.load(std::memory_order_acquire);
+
+            while (auto command = queue_.pop())
+            {
+                pending_.fetch_sub(1, std::memory_order_acq_rel);
+                (*command)();
+            }
+
+            if (pending_.load(std::memory_order_acquire) > 0)
+            {
+                // A submit is still linking its command into the queue
+                std::this_thread::yield();
+                continue;
+            }
+
+            if (!running_.load(std::memory_order_acquire))
+            {
+                return;
+            }
+            wakeups_.wait(seen, std::memory_order_acquire);
+        }
+    }
+}
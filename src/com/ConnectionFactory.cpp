@@ -20,11 +20,13 @@
 
 #include "com/ConnectionFactory.h"
 #include "com/CommunicationException.h"
+#include "com/ListeningConnection.h"
 #include "com/Mustang.h"
 #include "com/UsbComm.h"
 #include "com/UsbContext.h"
 #include "DeviceModel.h"
 #include <algorithm>
+#include <exception>
 
 namespace plug::com
 {
@@ -52,14 +54,20 @@ namespace plug::com
             usbPID::mustangI_II_v2,
             usbPID::mustangIII_IV_V_v2};
 
+        // The Mod and Dly/Rev knobs have 12 presets each: the load stream of a
+        // Mustang I/II is 140 packets (48 names, 8 state, 12 * 3 Mod and 12 * 4
+        // Dly/Rev), of a Mustang III/IV/V 292. The counts of the other models
+        // are unknown, their stream ends by the receive timeout.
+        inline constexpr std::size_t numberOfKnobPresets{12};
+
         DeviceModel getModel(std::uint16_t pid)
         {
             switch (pid)
             {
                 case usbPID::mustangI_II:
-                    return DeviceModel{"Mustang I/II", DeviceModel::Category::MustangV1, 24};
+                    return DeviceModel{"Mustang I/II", DeviceModel::Category::MustangV1, 24, numberOfKnobPresets, numberOfKnobPresets};
                 case usbPID::mustangIII_IV_V:
-                    return DeviceModel{"Mustang III/IV/V", DeviceModel::Category::MustangV1, 100};
+                    return DeviceModel{"Mustang III/IV/V", DeviceModel::Category::MustangV1, 100, numberOfKnobPresets, numberOfKnobPresets};
                 case usbPID::mustangBronco:
                     return DeviceModel{"Mustang Bronco", DeviceModel::Category::MustangV1, 0};
                 case usbPID::mustangMini:
@@ -67,29 +75,119 @@ namespace plug::com
                 case usbPID::mustangFloor:
                     return DeviceModel{"Mustang Floor", DeviceModel::Category::MustangV1, 0};
                 case usbPID::mustangI_II_v2:
-                    return DeviceModel{"Mustang I/II", DeviceModel::Category::MustangV2, 24};
+                    return DeviceModel{"Mustang I/II", DeviceModel::Category::MustangV2, 24, numberOfKnobPresets, numberOfKnobPresets};
                 case usbPID::mustangIII_IV_V_v2:
-                    return DeviceModel{"Mustang III/IV/V", DeviceModel::Category::MustangV2, 100};
+                    return DeviceModel{"Mustang III/IV/V", DeviceModel::Category::MustangV2, 100, numberOfKnobPresets, numberOfKnobPresets};
                 default:
                     throw CommunicationException{"Unknown device pid: " + std::to_string(pid)};
             }
         }
 
+        bool isAmp(const usb::Device& device)
+        {
+            return (device.vendorId() == usbVID) && std::any_of(pids.begin(), pids.end(), [&device](std::uint16_t pid)
+                                                                 { return device.productId() == pid; });
+        }
+
+        usb::Device findAmp()
+        {
+            auto devices = usb::listDevices(std::make_shared<usb::Context>());
+            auto itr = std::find_if(devices.begin(), devices.end(), isAmp);
+
+            if (itr == devices.end())
+            {
+                throw CommunicationException{"No device found"};
+            }
+            return std::move(*itr);
+        }
+
+        std::unique_ptr<Mustang> connectDevice(usb::Device device, const std::function<std::shared_ptr<Connection>(std::shared_ptr<Connection>)>& wrap)
+        {
+            const auto pid = device.productId();
+            auto location = device.location();
+            auto connection = std::make_shared<UsbComm>(std::move(device));
+            DeviceIdentity identity{usbVID, pid, connection->name(), std::move(location)};
+            return std::make_unique<Mustang>(getModel(pid), wrap(std::move(connection)), std::move(identity));
+        }
+
+        std::shared_ptr<Connection> direct(std::shared_ptr<Connection> connection)
+        {
+            return connection;
+        }
+
+        std::function<std::shared_ptr<Connection>(std::shared_ptr<Connection>)> listenWith(std::function<void(const AmpEvent&)> eventHandler)
+        {
+            return [eventHandler = std::move(eventHandler)](std::shared_ptr<Connection> connection) -> std::shared_ptr<Connection>
+            {
+                return std::make_shared<ListeningConnection>(std::move(connection), eventHandler);
+            };
+        }
     }
 
     std::unique_ptr<Mustang> connect()
     {
-        auto devices = usb::listDevices();
+        return connectDevice(findAmp(), direct);
+    }
+
+    std::vector<std::unique_ptr<Mustang>> connectAll()
+    {
+        auto devices = usb::listDevices(std::make_shared<usb::Context>());
+        std::vector<std::unique_ptr<Mustang>> amps;
+        std::exception_ptr firstError;
+
+        for (auto& device : devices)
+        {
+            if (!isAmp(device))
+            {
+                continue;
+            }
 
-        auto itr = std::find_if(devices.begin(), devices.end(), [](const auto& dev)
-                                { return (dev.vendorId() == usbVID) && std::any_of(pids.begin(), pids.end(), [&dev](std::uint16_t pid)
-                                                                                   { return dev.productId() == pid; }); });
+            // An amp in use elsewhere mustn't keep the others from connecting
+            try
+            {
+                amps.push_back(connectDevice(std::move(device), direct));
+            }
+            catch (const std::exception&)
+            {
+                if (!firstError)
+                {
+                    firstError = std::current_exception();
+                }
+            }
+        }
 
-        if (itr == devices.end())
+        if (amps.empty())
         {
+            if (firstError)
+            {
+                std::rethrow_exception(firstError);
+            }
             throw CommunicationException{"No device found"};
         }
-        return std::make_unique<Mustang>(getModel(itr->productId()), std::make_shared<UsbComm>(std::move(*itr)));
+        return amps;
+    }
+
+    std::unique_ptr<Mustang> connect(std::function<void(const AmpEvent&)> eventHandler)
+    {
+        return connectDevice(findAmp(), listenWith(std::move(eventHandler)));
+    }
+
+    std::unique_ptr<Mustang> connect(usb::Device device, std::function<void(const AmpEvent&)> eventHandler)
+    {
+        if (!isAmp(device))
+        {
+            throw CommunicationException{"Unknown device: " + std::to_string(device.vendorId()) + ":" + std::to_string(device.productId())};
+        }
+        return connectDevice(std::move(device), listenWith(std::move(eventHandler)));
+    }
+
+    std::unique_ptr<usb::Hotplug> watchAmps(usb::Hotplug::Handler handler)
+    {
+        if (!usb::hasHotplug())
+        {
+            return nullptr;
+        }
+        return std::make_unique<usb::Hotplug>(std::make_shared<usb::Context>(), usbVID, std::vector<std::uint16_t>{pids}, std::move(handler));
     }
 
 }
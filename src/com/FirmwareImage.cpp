@@ -0,0 +1,174 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "com/FirmwareImage.h"
+#include <algorithm>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace plug::com
+{
+    namespace
+    {
+        inline constexpr std::size_t dateOffset{0x1a};
+        inline constexpr std::size_t dateSize{11};
+        inline constexpr std::size_t payloadOffset{0x110};
+        inline constexpr std::size_t chunkSize{packetRawTypeSize - 8};
+
+
+        // Read-only mapping of a whole file
+        class MappedFile
+        {
+        public:
+            explicit MappedFile(const std::string& filename)
+                : data_(nullptr), size_(0)
+            {
+                const int fd = ::open(filename.c_str(), O_RDONLY);
+
+                if (fd < 0)
+                {
+                    throw std::runtime_error{"Can't open " + filename};
+                }
+
+                struct stat info{};
+
+                if ((::fstat(fd, &info) == 0) && (info.st_size > 0))
+                {
+                    void* data = ::mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+
+                    if (data != MAP_FAILED)
+                    {
+                        data_ = data;
+                        size_ = static_cast<std::size_t>(info.st_size);
+                    }
+                }
+                ::close(fd);
+            }
+
+            MappedFile(const MappedFile&) = delete;
+
+            ~MappedFile()
+            {
+                if (data_ != nullptr)
+                {
+                    ::munmap(data_, size_);
+                }
+            }
+
+            std::span<const std::uint8_t> bytes() const noexcept
+            {
+                return {static_cast<const std::uint8_t*>(data_), size_};
+            }
+
+            MappedFile& operator=(const MappedFile&) = delete;
+
+        private:
+            void* data_;
+            std::size_t size_;
+        };
+
+
+        bool isPrintable(std::uint8_t c)
+        {
+            return (c >= 0x20) && (c < 0x7f);
+        }
+
+        PacketRawType makePacket(std::uint8_t type, std::span<const std::uint8_t> data)
+        {
+            PacketRawType packet{};
+            packet[0] = type;
+            packet[1] = 0x03;
+            std::copy(data.begin(), data.end(), std::next(packet.begin(), 4));
+            return packet;
+        }
+    }
+
+
+    FirmwareImage::FirmwareImage(std::span<const std::uint8_t> data)
+        : date_(), payloadSize_(0), packets_()
+    {
+        if (data.size() <= payloadOffset)
+        {
+            throw std::invalid_argument{"Firmware image too small: " + std::to_string(data.size()) + " bytes"};
+        }
+
+        const auto date = data.subspan(dateOffset, dateSize);
+
+        if (!std::all_of(date.begin(), date.end(), isPrintable))
+        {
+            throw std::invalid_argument{"Firmware image has no valid build date"};
+        }
+        date_.assign(date.begin(), date.end());
+
+        const auto payload = data.subspan(payloadOffset);
+        payloadSize_ = payload.size();
+
+        // The payload ends with a shorter, possibly empty, chunk
+        const auto chunks = payload.size() / chunkSize + 1;
+        packets_.reserve(chunks + 2);
+
+        auto datePacket = makePacket(0x02, date);
+        datePacket[2] = 0x01;
+        datePacket[3] = 0x06;
+        packets_.push_back(datePacket);
+
+        for (std::size_t i = 0; i < chunks; ++i)
+        {
+            const auto offset = i * chunkSize;
+            const auto chunk = payload.subspan(offset, std::min(chunkSize, payload.size() - offset));
+            auto packet = makePacket(0x03, chunk);
+            packet[2] = static_cast<std::uint8_t>(i);
+            packet[3] = static_cast<std::uint8_t>(chunk.size());
+            packets_.push_back(packet);
+        }
+
+        packets_.push_back(makePacket(0x04, {}));
+    }
+
+    const std::string& FirmwareImage::date() const noexcept
+    {
+        return date_;
+    }
+
+    std::size_t FirmwareImage::payloadSize() const noexcept
+    {
+        return payloadSize_;
+    }
+
+    const std::vector<PacketRawType>& FirmwareImage::packets() const noexcept
+    {
+        return packets_;
+    }
+
+    std::chrono::milliseconds FirmwareImage::estimateDuration(std::chrono::microseconds roundTrip) const
+    {
+        return std::chrono::ceil<std::chrono::milliseconds>(roundTrip * packets_.size());
+    }
+
+
+    FirmwareImage loadFirmwareImage(const std::string& filename)
+    {
+        const MappedFile file{filename};
+        return FirmwareImage{file.bytes()};
+    }
+}
@@ -0,0 +1,333 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "com/ListeningConnection.h"
+#include "com/PacketSerializer.h"
+#include <algorithm>
+#include <vector>
+
+namespace plug::com
+{
+    namespace
+    {
+        // Same as the USB transfer timeout; a request is answered within this time
+        inline constexpr std::chrono::milliseconds exchangeWindow{500};
+        inline constexpr std::chrono::milliseconds retryDelay{100};
+
+        // Packets are classified on their raw header bytes, the decoders of the
+        // header throw on values they don't know: byte 0 is the stage, byte 1
+        // the type and byte 2 the DSP.
+        inline constexpr std::size_t posDsp{2};
+
+        inline constexpr std::uint8_t dspNone{0x00};
+        inline constexpr std::uint8_t dspAmp{0x05};
+        inline constexpr std::uint8_t dspEffect0{0x06};
+        inline constexpr std::uint8_t dspEffect1{0x07};
+        inline constexpr std::uint8_t dspEffect2{0x08};
+        inline constexpr std::uint8_t dspEffect3{0x09};
+
+        constexpr bool isDspData(const PacketRawType& packet)
+        {
+            return (packet[0] == 0x1c) && (packet[1] == 0x03) && (packet[posDsp] != dspNone);
+        }
+    }
+
+
+    ListeningConnection::ListeningConnection(std::shared_ptr<Connection> connection, EventHandler handler, std::size_t postedTransfers)
+        : connection_(std::move(connection)),
+          handler_(std::move(handler)),
+          postedTransfers_(std::max(postedTransfers, std::size_t{1})),
+          exchangeUntil_{},
+          lastAmp_{},
+          lastUsbGain_{},
+          selectedSlot_{},
+          selectedChain_{},
+          selection_{},
+          running_(true),
+          thread_([this]
+                  { run(); })
+    {
+    }
+
+    ListeningConnection::~ListeningConnection()
+    {
+        stop();
+    }
+
+    void ListeningConnection::close()
+    {
+        stop();
+        connection_->close();
+    }
+
+    bool ListeningConnection::isOpen() const
+    {
+        return connection_->isOpen();
+    }
+
+    std::vector<std::uint8_t> ListeningConnection::receive(std::size_t recvSize)
+    {
+        std::vector<std::uint8_t> buffer(recvSize);
+        buffer.resize(receiveImpl(buffer.data(), buffer.size()));
+        return buffer;
+    }
+
+    std::string ListeningConnection::name() const
+    {
+        return connection_->name();
+    }
+
+    std::size_t ListeningConnection::receiveImpl(std::uint8_t* data, std::size_t size)
+    {
+        std::unique_lock lock{mutex_};
+
+        if (!responseAvailable_.wait_for(lock, exchangeWindow, [this]
+                                         { return !responses_.empty() || !running_; }) ||
+            responses_.empty())
+        {
+            return 0;
+        }
+
+        const auto& packet = responses_.front();
+        const auto n = std::min(size, packet.size());
+        std::copy_n(packet.cbegin(), n, data);
+        responses_.pop_front();
+        exchangeUntil_ = Clock::now() + exchangeWindow;
+        return n;
+    }
+
+    std::size_t ListeningConnection::sendImpl(const std::uint8_t* data, std::size_t size)
+    {
+        {
+            std::lock_guard lock{mutex_};
+
+            // Responses nobody received belong to an earlier exchange
+            responses_.clear();
+            exchangeUntil_ = Clock::now() + exchangeWindow;
+        }
+        return connection_->send(std::span{data, size});
+    }
+
+    void ListeningConnection::stop()
+    {
+        {
+            std::lock_guard lock{mutex_};
+
+            if (!running_)
+            {
+                return;
+            }
+            running_ = false;
+        }
+        responseAvailable_.notify_all();
+        thread_.join();
+    }
+
+    // Each posted transfer receives into a buffer of its own, which is reused
+    // once the packet is dispatched. The transfers are kept in a ring and
+    // completed in the order they were posted.
+    void ListeningConnection::run()
+    {
+        struct PostedTransfer
+        {
+            PacketRawType buffer;
+            std::future<std::size_t> received;
+        };
+
+        std::vector<PostedTransfer> posted(postedTransfers_);
+        std::size_t next{0};
+
+        const auto isRunning = [this]
+        {
+            std::lock_guard lock{mutex_};
+            return running_;
+        };
+
+        while (isRunning())
+        {
+            auto& transfer = posted[next];
+            std::size_t received{0};
+
+            try
+            {
+                for (std::size_t i = 0; i < posted.size(); ++i)
+                {
+                    auto& slot = posted[(next + i) % posted.size()];
+
+                    if (!slot.received.valid())
+                    {
+                        slot.received = connection_->receiveAsync(std::span{slot.buffer});
+                    }
+                }
+
+                auto result = std::move(transfer.received);
+                next = (next + 1) % posted.size();
+                received = result.get();
+            }
+            catch (const std::exception&)
+            {
+                // The transfer failed (eg. device busy or gone), post again after a while
+                std::unique_lock lock{mutex_};
+                responseAvailable_.wait_for(lock, retryDelay, [this]
+                                            { return !running_; });
+                continue;
+            }
+
+            if (received == packetRawTypeSize)
+            {
+                dispatch(transfer.buffer);
+            }
+        }
+
+        // Posted transfers finish by their timeout at the latest
+        std::for_each(posted.begin(), posted.end(), [](auto& transfer)
+                      {
+                          if (transfer.received.valid())
+                          {
+                              transfer.received.wait();
+                          } });
+    }
+
+    void ListeningConnection::dispatch(const PacketRawType& packet)
+    {
+        if (isDspData(packet))
+        {
+            handleDspData(packet);
+            return;
+        }
+
+        {
+            std::lock_guard lock{mutex_};
+
+            if (Clock::now() < exchangeUntil_)
+            {
+                responses_.push_back(packet);
+                responseAvailable_.notify_all();
+                return;
+            }
+        }
+        handleUnsolicited(packet);
+    }
+
+    void ListeningConnection::handleDspData(const PacketRawType& packet)
+    {
+        // Unknown DSPs and model ids are dropped, there's nothing that could be shown
+        switch (packet[posDsp])
+        {
+            case dspAmp:
+                lastAmp_ = fromRawData<AmpPayload>(packet);
+                notifyAmp();
+                break;
+            case usbGainReportDsp:
+                // The gain alone isn't enough for the amp settings
+                lastUsbGain_ = fromRawData<AmpPayload>(packet);
+                notifyAmp();
+                break;
+            case dspEffect0:
+            case dspEffect1:
+            case dspEffect2:
+            case dspEffect3:
+                if (const auto effect = tryDecodeEffectFromData(PacketView<EffectPayload>{packet}))
+                {
+                    notify(event::EffectChanged{*effect});
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+    void ListeningConnection::notifyAmp()
+    {
+        if (!lastAmp_)
+        {
+            return;
+        }
+
+        if (const auto amp = tryDecodeAmpFromData(*lastAmp_, lastUsbGain_))
+        {
+            notify(event::AmpChanged{*amp});
+        }
+    }
+
+    void ListeningConnection::handleUnsolicited(const PacketRawType& packet)
+    {
+        if (!selection_)
+        {
+            selectedSlot_.reset();
+            selectedChain_ = SignalChainBuilder{};
+            selection_ = std::make_unique<LoadStreamParser>(LoadStreamParser::Stream::bank, [this](const load::Event& loadEvent)
+                                                            { handleStreamEvent(loadEvent); });
+        }
+
+        selection_->push(packet);
+
+        if (selection_->finished())
+        {
+            selection_.reset();
+        }
+    }
+
+    void ListeningConnection::handleStreamEvent(const load::Event& loadEvent)
+    {
+        std::visit(selectedChain_, loadEvent);
+
+        if (const auto* current = std::get_if<load::CurrentName>(&loadEvent))
+        {
+            selectedSlot_ = current->slot;
+        }
+        else if (const auto* amp = std::get_if<load::AmpState>(&loadEvent))
+        {
+            lastAmp_ = Packet<AmpPayload>{amp->packet};
+        }
+        else if (const auto* usbGain = std::get_if<load::UsbGainState>(&loadEvent))
+        {
+            lastUsbGain_ = Packet<AmpPayload>{usbGain->packet};
+        }
+        else if (std::holds_alternative<load::EndOfState>(loadEvent) && selectedSlot_)
+        {
+            try
+            {
+                notify(event::PresetSelected{*selectedSlot_, selectedChain_.build()});
+            }
+            catch (const std::exception&)
+            {
+                // Incomplete selection, eg. the tail of a response
+            }
+        }
+    }
+
+    void ListeningConnection::notify(const AmpEvent& ampEvent)
+    {
+        if (!handler_)
+        {
+            return;
+        }
+
+        try
+        {
+            handler_(ampEvent);
+        }
+        catch (const std::exception&)
+        {
+            // A failing handler loses this event only, the listener keeps running
+        }
+    }
+}
@@ -0,0 +1,179 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "com/LiveUpdater.h"
+#include "com/PacketSerializer.h"
+#include <algorithm>
+
+namespace plug::com
+{
+    LiveUpdater::LiveUpdater(Send send, unsigned int maxRate, StatsHandler statsHandler)
+        : send_(std::move(send)),
+          interval_(std::chrono::duration_cast<Clock::duration>(std::chrono::seconds{1}) / std::max(maxRate, 1u)),
+          statsHandler_(std::move(statsHandler)),
+          pending_{},
+          stats_{},
+          totalLatency_{0},
+          running_(true),
+          thread_([this]
+                  { run(); })
+    {
+    }
+
+    LiveUpdater::~LiveUpdater()
+    {
+        {
+            std::lock_guard lock{mutex_};
+            running_ = false;
+        }
+        condition_.notify_one();
+        thread_.join();
+    }
+
+    void LiveUpdater::update(const amp_settings& value)
+    {
+        std::lock_guard lock{mutex_};
+        const bool replaced = pending_.amp.has_value();
+        pending_.amp = value;
+        markPending(replaced);
+    }
+
+    void LiveUpdater::update(const fx_pedal_settings& value)
+    {
+        const auto dsp = dspFromEffect(value.effect_num);
+
+        if (dsp == DSP::none)
+        {
+            return;
+        }
+
+        std::lock_guard lock{mutex_};
+        auto& effect = pending_.effects[static_cast<std::size_t>(dsp) - static_cast<std::size_t>(DSP::effect0)];
+        const bool replaced = effect.has_value();
+        effect = value;
+        markPending(replaced);
+    }
+
+    LiveStats LiveUpdater::stats() const
+    {
+        std::lock_guard lock{mutex_};
+        return stats_;
+    }
+
+    void LiveUpdater::markPending(bool replaced)
+    {
+        ++stats_.updates;
+
+        if (replaced)
+        {
+            ++stats_.coalesced;
+        }
+        if (!pending_.since)
+        {
+            pending_.since = Clock::now();
+        }
+        condition_.notify_one();
+    }
+
+    bool LiveUpdater::hasPending() const
+    {
+        return pending_.since.has_value();
+    }
+
+    void LiveUpdater::run()
+    {
+        auto nextTransfer = Clock::now();
+
+        while (true)
+        {
+            std::unique_lock lock{mutex_};
+            condition_.wait(lock, [this]
+                            { return hasPending() || !running_; });
+
+            if (!hasPending())
+            {
+                return;
+            }
+
+            // Updates arriving until the next transfer replace the pending values
+            condition_.wait_until(lock, nextTransfer, [this]
+                                  { return !running_; });
+
+            CommandBatch batch;
+
+            if (pending_.amp)
+            {
+                batch.set_amplifier(*pending_.amp);
+            }
+            std::for_each(pending_.effects.cbegin(), pending_.effects.cend(), [&batch](const auto& effect)
+                          {
+                if (effect)
+                {
+                    batch.set_effect(*effect);
+                } });
+
+            const auto since = *pending_.since;
+            pending_ = Pending{};
+            lock.unlock();
+
+            const auto start = Clock::now();
+            nextTransfer = start + interval_;
+
+            try
+            {
+                send_(batch);
+            }
+            catch (const std::exception&)
+            {
+                // A failed live update is superseded by the next one
+            }
+            record(since, Clock::now());
+        }
+    }
+
+    void LiveUpdater::record(Clock::time_point since, Clock::time_point done)
+    {
+        LiveStats current{};
+        {
+            std::lock_guard lock{mutex_};
+            const auto latency = std::chrono::duration_cast<std::chrono::microseconds>(done - since);
+
+            if (!firstTransfer_)
+            {
+                firstTransfer_ = done;
+            }
+            ++stats_.transfers;
+            totalLatency_ += latency;
+            stats_.averageLatency = totalLatency_ / stats_.transfers;
+            stats_.maxLatency = std::max(stats_.maxLatency, latency);
+
+            if (const std::chrono::duration<double> elapsed = done - *firstTransfer_; elapsed.count() > 0.0)
+            {
+                stats_.transfersPerSecond = static_cast<double>(stats_.transfers - 1) / elapsed.count();
+            }
+            current = stats_;
+        }
+
+        if (statsHandler_)
+        {
+            statsHandler_(current);
+        }
+    }
+}
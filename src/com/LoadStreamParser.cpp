@@ -0,0 +1,220 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "com/LoadStreamParser.h"
+#include "com/PacketSerializer.h"
+
+namespace plug::com
+{
+    namespace
+    {
+        // Every packet of the load and bank streams starts with "0x1c 0x01"; byte 2
+        // carries the DSP, byte 3 the knob (0x00 for amp presets, 0x01 for Mod and
+        // 0x02 for Dly/Rev knob presets) and byte 4 the slot.
+        inline constexpr std::size_t posDsp{2};
+        inline constexpr std::size_t posKnob{3};
+        inline constexpr std::size_t posSlot{4};
+
+        inline constexpr std::uint8_t dspConfirmation{0x00};
+        inline constexpr std::uint8_t dspName{0x04};
+        inline constexpr std::uint8_t dspAmp{0x05};
+        inline constexpr std::uint8_t dspEffect0{0x06};
+        inline constexpr std::uint8_t dspEffect3{0x09};
+
+        inline constexpr std::uint8_t knobNone{0x00};
+        inline constexpr std::uint8_t knobMod{0x01};
+        inline constexpr std::uint8_t knobDlyRev{0x02};
+
+        // Name, amp, four effects, USB gain and confirmation
+        inline constexpr std::size_t statePackets{8};
+        // Models without a known preset count have at most as many as the Mustang III/IV/V
+        inline constexpr std::size_t maxNumberOfPresets{100};
+
+        constexpr bool isStreamPacket(const PacketRawType& packet)
+        {
+            return (packet[0] == 0x1c) && (packet[1] == 0x01);
+        }
+
+        // Names and confirmations, the state, then the knob presets: a Mod preset
+        // is a name, one effect and a confirmation; a Dly/Rev preset has two effects
+        std::size_t loadStreamPackets(const DeviceModel& model)
+        {
+            const auto numberOfPresets = model.numberOfPresets() > 0 ? model.numberOfPresets() : maxNumberOfPresets;
+            return (numberOfPresets * 2) + statePackets + (model.numberOfModPresets() * 3) + (model.numberOfDlyRevPresets() * 4);
+        }
+    }
+
+
+    LoadStreamParser::LoadStreamParser(Stream stream, std::function<void(const load::Event&)> handler)
+        : LoadStreamParser(stream, std::move(handler), DeviceModel{"", DeviceModel::Category::Other, 0})
+    {
+    }
+
+    LoadStreamParser::LoadStreamParser(Stream stream, std::function<void(const load::Event&)> handler, const DeviceModel& model)
+        : LoadStreamParser(stream, std::move(handler), model.numberOfModPresets(), model.numberOfDlyRevPresets(),
+                           stream == Stream::load ? loadStreamPackets(model) : statePackets)
+    {
+    }
+
+    LoadStreamParser::LoadStreamParser(Stream stream, std::function<void(const load::Event&)> handler,
+                                       std::size_t numberModPresets, std::size_t numberDlyRevPresets, std::size_t capacity)
+        : stream_(stream), handler_(std::move(handler)), expectedModPresets_(numberModPresets), expectedDlyRevPresets_(numberDlyRevPresets),
+          arena_(capacity), stateReceived_(false), modPresets_(0), dlyRevPresets_(0), finished_(false)
+    {
+    }
+
+    void LoadStreamParser::push(const PacketRawType& packet)
+    {
+        if (finished_ || !isStreamPacket(packet))
+        {
+            return;
+        }
+
+        arena_.allocate() = packet;
+        const auto index = arena_.size() - 1;
+        const auto dsp = packet[posDsp];
+
+        if (const auto knob = packet[posKnob]; knob != knobNone)
+        {
+            pushKnobPreset(index, dsp, knob);
+        }
+        else
+        {
+            pushState(index, dsp);
+        }
+    }
+
+    bool LoadStreamParser::finished() const noexcept
+    {
+        return finished_;
+    }
+
+    void LoadStreamParser::pushState(std::size_t index, std::uint8_t dsp)
+    {
+        if (dsp == dspName)
+        {
+            pendingName_ = index;
+            return;
+        }
+
+        if (dsp == dspConfirmation)
+        {
+            if (pendingName_)
+            {
+                handler_(load::PresetName{slotOf(*pendingName_), nameOf(*pendingName_)});
+                pendingName_.reset();
+            }
+            else
+            {
+                stateReceived_ = true;
+                handler_(load::EndOfState{});
+
+                if (stream_ == Stream::bank)
+                {
+                    finish();
+                }
+            }
+            return;
+        }
+
+        // A name followed by data instead of a confirmation is the current preset
+        if (pendingName_)
+        {
+            handler_(load::CurrentName{slotOf(*pendingName_), nameOf(*pendingName_)});
+            pendingName_.reset();
+        }
+
+        const auto& packet = arena_[index];
+
+        if (dsp == dspAmp)
+        {
+            handler_(load::AmpState{PacketView<AmpPayload>{packet}});
+        }
+        else if ((dsp >= dspEffect0) && (dsp <= dspEffect3))
+        {
+            handler_(load::EffectState{static_cast<std::size_t>(dsp - dspEffect0), PacketView<EffectPayload>{packet}});
+        }
+        else if (dsp == usbGainReportDsp)
+        {
+            handler_(load::UsbGainState{PacketView<AmpPayload>{packet}});
+        }
+    }
+
+    // The effects of a knob preset are the packets between its name and its
+    // confirmation
+    void LoadStreamParser::pushKnobPreset(std::size_t index, std::uint8_t dsp, std::uint8_t knob)
+    {
+        if (dsp == dspName)
+        {
+            pendingPreset_ = PendingPreset{knob, index};
+            return;
+        }
+
+        if (dsp != dspConfirmation)
+        {
+            return;
+        }
+
+        const auto slot = pendingPreset_ ? slotOf(pendingPreset_->name) : slotOf(index);
+        const auto name = pendingPreset_ ? nameOf(pendingPreset_->name) : std::string_view{};
+        const auto effects = pendingPreset_ ? arena_.packets(pendingPreset_->name + 1, index - pendingPreset_->name - 1)
+                                            : std::span<const PacketRawType>{};
+        pendingPreset_.reset();
+
+        if (knob == knobMod)
+        {
+            ++modPresets_;
+            handler_(load::ModKnobPreset{slot, name, effects});
+        }
+        else if (knob == knobDlyRev)
+        {
+            ++dlyRevPresets_;
+            handler_(load::DlyRevKnobPreset{slot, name, effects});
+        }
+
+        const bool countsKnown = (expectedModPresets_ > 0) && (expectedDlyRevPresets_ > 0);
+
+        if (stateReceived_ && countsKnown && (modPresets_ >= expectedModPresets_) && (dlyRevPresets_ >= expectedDlyRevPresets_))
+        {
+            finish();
+        }
+    }
+
+    std::string_view LoadStreamParser::nameOf(std::size_t index) const
+    {
+        return PacketView<NamePayload>{arena_[index]}.getPayload().getNameView();
+    }
+
+    std::uint8_t LoadStreamParser::slotOf(std::size_t index) const
+    {
+        return arena_[index][posSlot];
+    }
+
+    void LoadStreamParser::finish()
+    {
+        finished_ = true;
+        handler_(load::EndOfStream{});
+    }
+
+    SignalChain SignalChainBuilder::build() const
+    {
+        return SignalChain{name, decodeAmpFromData(amp, usbGain), decodeEffectsFromData(effects)};
+    }
+}
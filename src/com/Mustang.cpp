@@ -23,64 +23,143 @@
 #include "com/PacketSerializer.h"
 #include "com/CommunicationException.h"
 #include "com/Packet.h"
+#include "com/LoadStreamParser.h"
 #include <algorithm>
 
 namespace plug::com
 {
-    SignalChain decode_data(const std::array<PacketRawType, 7>& data)
+    namespace
     {
-        const auto name = decodeNameFromData(fromRawData<NamePayload>(data[0]));
-        const auto amp = decodeAmpFromData(fromRawData<AmpPayload>(data[1]), fromRawData<AmpPayload>(data[6]));
-        const auto effects = decodeEffectsFromData({{fromRawData<EffectPayload>(data[2]), fromRawData<EffectPayload>(data[3]),
-                                                     fromRawData<EffectPayload>(data[4]), fromRawData<EffectPayload>(data[5])}});
+        // Active effect of each effect DSP (stompbox, modulation, delay, reverb)
+        using EffectDsps = std::array<std::optional<fx_pedal_settings>, 4>;
 
-        return SignalChain{name, amp, effects};
+        std::optional<std::size_t> effectDspIndex(effects effect)
+        {
+            const auto dsp = dspFromEffect(effect);
+
+            if (dsp == DSP::none)
+            {
+                return std::nullopt;
+            }
+            return static_cast<std::size_t>(dsp) - static_cast<std::size_t>(DSP::effect0);
+        }
+
+        EffectDsps toEffectDsps(const std::vector<fx_pedal_settings>& effects)
+        {
+            EffectDsps dsps{};
+            std::for_each(effects.cbegin(), effects.cend(), [&dsps](const auto& effect)
+                          {
+                if (const auto index = effectDspIndex(effect.effect_num); index && effect.enabled)
+                {
+                    dsps[*index] = effect;
+                } });
+            return dsps;
+        }
+
+        std::vector<fx_pedal_settings> fromEffectDsps(const EffectDsps& dsps)
+        {
+            std::vector<fx_pedal_settings> effects;
+            std::for_each(dsps.cbegin(), dsps.cend(), [&effects](const auto& effect)
+                          {
+                if (effect)
+                {
+                    effects.push_back(*effect);
+                } });
+            return effects;
+        }
+
+        // Only active effects are kept, so equal chains compare equal per DSP
+        SignalChain normalized(const SignalChain& chain)
+        {
+            return SignalChain{chain.name(), chain.amp(), fromEffectDsps(toEffectDsps(chain.effects()))};
+        }
     }
 
-    std::vector<std::uint8_t> receivePacket(Connection& conn)
+
+    std::size_t receivePacket(Connection& conn, PacketRawType& packet)
     {
-        return conn.receive(packetRawTypeSize);
+        return conn.receive(std::span{packet});
     }
 
 
     void sendCommand(Connection& conn, const PacketRawType& packet)
     {
         conn.send(packet);
-        receivePacket(conn);
+        PacketRawType response;
+        receivePacket(conn, response);
     }
 
     void sendApplyCommand(Connection& conn)
     {
-        sendCommand(conn, serializeApplyCommand().getBytes());
+        sendCommand(conn, applyCommandPacket);
     }
 
-    std::array<PacketRawType, 7> loadBankData(Connection& conn, std::uint8_t slot)
+    void sendWithSingleApply(Connection& conn, const std::vector<PacketRawType>& packets)
     {
-        std::array<PacketRawType, 7> data{{}};
+        if (packets.empty())
+        {
+            return;
+        }
 
-        const auto loadCommand = serializeLoadSlotCommand(slot);
-        auto n = conn.send(loadCommand.getBytes());
+        std::for_each(packets.cbegin(), packets.cend(), [&conn](const auto& p)
+                      { sendCommand(conn, p); });
+        sendApplyCommand(conn);
+    }
 
-        for (std::size_t i = 0; n != 0; ++i)
+    // Pushes received packets to the parser until the stream ends or the amp stops sending
+    void receiveStream(Connection& conn, LoadStreamParser& parser)
+    {
+        while (parser.finished() == false)
         {
-            const auto recvData = receivePacket(conn);
-            n = recvData.size();
+            PacketRawType packet{};
 
-            if (i < 7)
+            if (receivePacket(conn, packet) == 0)
             {
-                std::copy(recvData.cbegin(), recvData.cend(), data[i].begin());
+                return;
             }
+            parser.push(packet);
         }
-        return data;
+    }
+
+    void requestBankData(Connection& conn, std::uint8_t slot, LoadStreamParser& parser)
+    {
+        // Every slot of the amps has a prebuilt command, sent without a copy
+        const auto sent = (slot < loadSlotCommandPackets.size()) ? conn.send(loadSlotCommandPackets[slot])
+                                                                 : conn.send(serializeLoadSlotCommandBytes(slot));
+
+        if (sent != 0)
+        {
+            receiveStream(conn, parser);
+        }
+    }
+
+    SignalChain loadBankData(Connection& conn, std::uint8_t slot)
+    {
+        SignalChainBuilder builder;
+        LoadStreamParser parser{LoadStreamParser::Stream::bank, [&builder](const load::Event& event)
+                                { std::visit(builder, event); }};
+
+        requestBankData(conn, slot, parser);
+        return builder.build();
     }
 
 
     Mustang::Mustang(DeviceModel deviceModel, std::shared_ptr<Connection> connection)
-        : model(deviceModel), conn(connection)
+        : Mustang(deviceModel, connection, DeviceIdentity{})
+    {
+    }
+
+    Mustang::Mustang(DeviceModel deviceModel, std::shared_ptr<Connection> connection, DeviceIdentity deviceIdentity)
+        : model(deviceModel), conn(connection), identity(std::move(deviceIdentity))
     {
     }
 
     InitialData Mustang::start_amp()
+    {
+        return start_amp(StartObserver{});
+    }
+
+    InitialData Mustang::start_amp(const StartObserver& observer)
     {
         if (conn->isOpen() == false)
         {
@@ -89,11 +168,14 @@ namespace plug::com
 
         initializeAmp();
 
-        return loadData();
+        auto data = loadData(observer);
+        state = normalized(data.signalChain);
+        return data;
     }
 
     void Mustang::stop_amp()
     {
+        state.reset();
         conn->close();
     }
 
@@ -109,6 +191,7 @@ namespace plug::com
             sendCommand(*conn, settingsPacket.getBytes());
             sendApplyCommand(*conn);
         }
+        updateCachedState(value);
     }
 
     void Mustang::set_amplifier(amp_settings value)
@@ -120,18 +203,93 @@ namespace plug::com
         const auto settingsGainPacket = serializeAmpSettingsUsbGain(value);
         sendCommand(*conn, settingsGainPacket.getBytes());
         sendApplyCommand(*conn);
+        updateCachedState(value);
+    }
+
+    void Mustang::commit(const CommandBatch& batch)
+    {
+        sendWithSingleApply(*conn, batch.packets());
+
+        if (const auto& chain = batch.signalChain(); chain)
+        {
+            state = normalized(*chain);
+        }
+
+        if (const auto& amp = batch.amplifier(); amp)
+        {
+            updateCachedState(*amp);
+        }
+        std::for_each(batch.effects().cbegin(), batch.effects().cend(), [this](const auto& effect)
+                      { updateCachedState(effect); });
+    }
+
+    std::size_t Mustang::apply(const SignalChain& chain)
+    {
+        const auto target = normalized(chain);
+        const auto targetDsps = toEffectDsps(target.effects());
+        const auto currentDsps = state ? toEffectDsps(state->effects()) : EffectDsps{};
+        std::vector<PacketRawType> packets;
+
+        const auto ampPacket = serializeAmpSettings(target.amp()).getBytes();
+
+        if (!state || (serializeAmpSettings(state->amp()).getBytes() != ampPacket))
+        {
+            packets.push_back(ampPacket);
+        }
+
+        const auto usbGainPacket = serializeAmpSettingsUsbGain(target.amp()).getBytes();
+
+        if (!state || (serializeAmpSettingsUsbGain(state->amp()).getBytes() != usbGainPacket))
+        {
+            packets.push_back(usbGainPacket);
+        }
+
+        for (std::size_t i = 0; i < targetDsps.size(); ++i)
+        {
+            const auto& wanted = targetDsps[i];
+            const auto& current = currentDsps[i];
+
+            if (wanted)
+            {
+                const auto packet = serializeEffectSettings(*wanted).getBytes();
+
+                if (!current || (serializeEffectSettings(*current).getBytes() != packet))
+                {
+                    packets.push_back(packet);
+                }
+            }
+            else if (!state || current)
+            {
+                const fx_pedal_settings clear{FxSlot{0}, dspClearEffects[i], 0, 0, 0, 0, 0, 0, false};
+                packets.push_back(serializeClearEffectSettings(clear).getBytes());
+            }
+        }
+
+        sendWithSingleApply(*conn, packets);
+        state = target;
+        return packets.size();
     }
 
     void Mustang::save_on_amp(std::string_view name, std::uint8_t slot)
     {
         const auto data = serializeName(slot, name).getBytes();
         sendCommand(*conn, data);
-        loadBankData(*conn, slot);
+
+        // The amp answers with the bank data, which is of no further interest here
+        LoadStreamParser parser{LoadStreamParser::Stream::bank, [](const load::Event&) {}};
+        requestBankData(*conn, slot, parser);
+
+        if (state)
+        {
+            state->setName(std::string{name});
+        }
     }
 
     SignalChain Mustang::load_memory_bank(std::uint8_t slot)
     {
-        return decode_data(loadBankData(*conn, slot));
+        auto signalChain = loadBankData(*conn, slot);
+        state = normalized(signalChain);
+        return signalChain;
     }
 
     void Mustang::save_effects(std::uint8_t slot, std::string_view name, const std::vector<fx_pedal_settings>& effects)
@@ -144,6 +302,23 @@ namespace plug::com
                       { sendCommand(*conn, p.getBytes()); });
 
         sendCommand(*conn, serializeApplyCommand(effects[0]).getBytes());
+        state.reset();
+    }
+
+    void Mustang::track(const AmpEvent& ampEvent)
+    {
+        if (const auto* amp = std::get_if<event::AmpChanged>(&ampEvent))
+        {
+            updateCachedState(amp->amp);
+        }
+        else if (const auto* effect = std::get_if<event::EffectChanged>(&ampEvent))
+        {
+            updateCachedState(effect->effect);
+        }
+        else if (const auto* preset = std::get_if<event::PresetSelected>(&ampEvent))
+        {
+            state = normalized(preset->signalChain);
+        }
     }
 
     DeviceModel Mustang::getDeviceModel() const
@@ -151,43 +326,84 @@ namespace plug::com
         return model;
     }
 
+    DeviceIdentity Mustang::getDeviceIdentity() const
+    {
+        return identity;
+    }
+
+    const std::optional<SignalChain>& Mustang::cachedState() const
+    {
+        return state;
+    }
+
 
-    InitialData Mustang::loadData()
+    InitialData Mustang::loadData(const StartObserver& observer)
     {
-        std::vector<std::array<std::uint8_t, 64>> recieved_data;
+        SignalChainBuilder builder;
+        std::vector<std::string> presetNames;
+        presetNames.reserve(model.numberOfPresets());
+
+        LoadStreamParser parser{LoadStreamParser::Stream::load, [&builder, &presetNames, &observer](const load::Event& event)
+                                {
+                                    if (const auto preset = std::get_if<load::PresetName>(&event); preset != nullptr)
+                                    {
+                                        presetNames.emplace_back(preset->name);
+
+                                        if (observer.presetName)
+                                        {
+                                            observer.presetName(presetNames.size() - 1, presetNames.back());
+                                        }
+                                    }
+                                    else if (std::holds_alternative<load::EndOfState>(event) && observer.signalChain)
+                                    {
+                                        observer.signalChain(builder.build());
+                                    }
+                                    else
+                                    {
+                                        std::visit(builder, event);
+                                    }
+                                },
+                                model};
+
+        if (conn->send(loadCommandPacket) != 0)
+        {
+            receiveStream(*conn, parser);
+        }
+        return {builder.build(), presetNames};
+    }
 
-        const auto loadCommand = serializeLoadCommand();
-        auto recieved = conn->send(loadCommand.getBytes());
+    void Mustang::updateCachedState(const amp_settings& value)
+    {
+        if (state)
+        {
+            state->setAmp(value);
+        }
+    }
 
-        while (recieved != 0)
+    void Mustang::updateCachedState(const fx_pedal_settings& value)
+    {
+        if (!state)
         {
-            const auto recvData = receivePacket(*conn);
-            recieved = recvData.size();
-            PacketRawType p{};
-            std::copy(recvData.cbegin(), recvData.cend(), p.begin());
-            recieved_data.push_back(p);
+            return;
         }
 
-        const std::size_t numPresetPackets = model.numberOfPresets() > 0 ? (model.numberOfPresets() * 2) : (recieved_data.size() > 143 ? 200 : 48);
-        std::vector<Packet<NamePayload>> presetListData;
-        presetListData.reserve(numPresetPackets);
-        std::transform(recieved_data.cbegin(), std::next(recieved_data.cbegin(), numPresetPackets), std::back_inserter(presetListData), [](const auto& p)
-                       {
-            Packet<NamePayload> packet{};
-            packet.fromBytes(p);
-            return packet; });
-        auto presetNames = decodePresetListFromData(presetListData);
+        // Without an effect the written DSP is unknown
+        const auto index = effectDspIndex(value.effect_num);
 
-        std::array<PacketRawType, 7> presetData{{}};
-        std::copy(std::next(recieved_data.cbegin(), numPresetPackets), std::next(recieved_data.cbegin(), numPresetPackets + 7), presetData.begin());
+        if (!index)
+        {
+            state.reset();
+            return;
+        }
 
-        return {decode_data(presetData), presetNames};
+        auto dsps = toEffectDsps(state->effects());
+        dsps[*index] = value.enabled ? std::optional{value} : std::nullopt;
+        state->setEffects(fromEffectDsps(dsps));
     }
 
     void Mustang::initializeAmp()
     {
-        const auto packets = serializeInitCommand();
-        std::for_each(packets.cbegin(), packets.cend(), [this](const auto& p)
-                      { sendCommand(*conn, p.getBytes()); });
+        std::for_each(initCommandPackets.cbegin(), initCommandPackets.cend(), [this](const auto& p)
+                      { sendCommand(*conn, p); });
     }
 }
@@ -20,13 +20,13 @@
  */
 
 #include "com/MustangUpdater.h"
-#include "com/Mustang.h"
-#include "com/Packet.h"
-#include <chrono>
-#include <cstdio>
-#include <cstring>
-#include <unistd.h>
-#include <libusb-1.0/libusb.h>
+#include "com/UsbComm.h"
+#include "com/UsbContext.h"
+#include "com/UsbException.h"
+#include <algorithm>
+#include <array>
+#include <optional>
+#include <stdexcept>
 
 namespace plug::com
 {
@@ -44,130 +44,105 @@ namespace plug::com
 
     namespace
     {
-        void closeUsb(libusb_device_handle* handle)
-        {
-            if (handle != nullptr)
-            {
-                const int ret = libusb_release_interface(handle, 0);
+        inline constexpr std::array<std::uint16_t, 6> updatePids{
+            SMALL_AMPS_USB_UPDATE_PID,
+            BIG_AMPS_USB_UPDATE_PID,
+            SMALL_AMPS_V2_USB_UPDATE_PID,
+            BIG_AMPS_V2_USB_UPDATE_PID,
+            MINI_USB_UPDATE_PID,
+            FLOOR_USB_UPDATE_PID};
 
-                if (ret != LIBUSB_ERROR_NO_DEVICE)
-                {
-                    libusb_attach_kernel_driver(handle, 0);
-                }
 
-                libusb_close(handle);
-                libusb_exit(nullptr);
+        std::optional<usb::Device> findUpdateDevice()
+        {
+            auto devices = usb::listDevices(std::make_shared<usb::Context>());
+            auto itr = std::find_if(devices.begin(), devices.end(), [](const usb::Device& device)
+                                    { return (device.vendorId() == USB_UPDATE_VID) && (std::find(updatePids.cbegin(), updatePids.cend(), device.productId()) != updatePids.cend()); });
+
+            if (itr == devices.end())
+            {
+                return std::nullopt;
             }
+            return std::move(*itr);
         }
-
-
-        inline constexpr std::chrono::milliseconds timeout{500};
-        inline constexpr std::size_t sizeOfPacket = packetRawTypeSize;
     }
 
 
-    int updateFirmware(const char* filename)
+    void sendFirmware(Connection& device, const FirmwareImage& image, const UpdateProgressHandler& progress)
     {
-        // initialize libusb
-        int ret = libusb_init(nullptr);
-        if (ret != 0)
-        {
-            return ret;
-        }
+        using Clock = std::chrono::steady_clock;
+
+        const auto& packets = image.packets();
+        const auto start = Clock::now();
 
-        // get handle for the device
-        libusb_device_handle* amp_hand = libusb_open_device_with_vid_pid(nullptr, USB_UPDATE_VID, SMALL_AMPS_USB_UPDATE_PID);
-        if (amp_hand == nullptr)
+        for (std::size_t i = 0; i < packets.size(); ++i)
         {
-            amp_hand = libusb_open_device_with_vid_pid(nullptr, USB_UPDATE_VID, BIG_AMPS_USB_UPDATE_PID);
-            if (amp_hand == nullptr)
+            device.send(packets[i]);
+
+            if (i + 1 < packets.size())
+            {
+                device.receive(packetRawTypeSize);
+            }
+            else
             {
-                amp_hand = libusb_open_device_with_vid_pid(nullptr, USB_UPDATE_VID, SMALL_AMPS_V2_USB_UPDATE_PID);
-                if (amp_hand == nullptr)
+                // The amp may already be restarting, so its last answer is optional
+                try
+                {
+                    device.receive(packetRawTypeSize);
+                }
+                catch (const std::exception&)
                 {
-                    amp_hand = libusb_open_device_with_vid_pid(nullptr, USB_UPDATE_VID, BIG_AMPS_V2_USB_UPDATE_PID);
-                    if (amp_hand == nullptr)
-                    {
-                        amp_hand = libusb_open_device_with_vid_pid(nullptr, USB_UPDATE_VID, MINI_USB_UPDATE_PID);
-                        if (amp_hand == nullptr)
-                        {
-                            amp_hand = libusb_open_device_with_vid_pid(nullptr, USB_UPDATE_VID, FLOOR_USB_UPDATE_PID);
-                            if (amp_hand == nullptr)
-                            {
-                                libusb_exit(nullptr);
-                                return -100;
-                            }
-                        }
-                    }
                 }
             }
-        }
 
-        // detach kernel driver
-        ret = libusb_kernel_driver_active(amp_hand, 0);
-        if (ret != 0)
-        {
-            ret = libusb_detach_kernel_driver(amp_hand, 0);
-            if (ret != 0)
+            if (progress)
             {
-                closeUsb(amp_hand);
-                return ret;
+                const auto elapsed = Clock::now() - start;
+                const auto seconds = std::chrono::duration<double>(elapsed).count();
+                const auto bytesSent = static_cast<double>((i + 1) * packetRawTypeSize);
+                progress(UpdateProgress{i + 1, packets.size(),
+                                        std::chrono::duration_cast<std::chrono::milliseconds>(elapsed),
+                                        seconds > 0.0 ? bytesSent / seconds : 0.0});
             }
         }
+    }
 
-        // claim the device
-        ret = libusb_claim_interface(amp_hand, 0);
-        if (ret != 0)
+    int updateFirmware(const FirmwareImage& image, const UpdateProgressHandler& progress)
+    {
+        try
         {
-            closeUsb(amp_hand);
-            return ret;
-        }
+            auto device = findUpdateDevice();
 
-        FILE* file = fopen(filename, "rb");
-        // send date when firmware was created
-        fseek(file, 0x1a, SEEK_SET);
-        unsigned char array[sizeOfPacket];
-        memset(array, 0x00, sizeOfPacket);
-        array[0] = 0x02;
-        array[1] = 0x03;
-        array[2] = 0x01;
-        array[3] = 0x06;
-        [[maybe_unused]] const auto n = fread(array + 4, 1, 11, file);
-        int recieved{0};
-        ret = libusb_interrupt_transfer(amp_hand, 0x01, array, sizeOfPacket, &recieved, timeout.count());
-        libusb_interrupt_transfer(amp_hand, 0x81, array, sizeOfPacket, &recieved, timeout.count());
-        usleep(10000);
-
-        // send firmware
-        fseek(file, 0x110, SEEK_SET);
-        for (;;)
-        {
-            memset(array, 0x00, sizeOfPacket);
-            unsigned char number{0};
-            array[0] = array[1] = 0x03;
-            array[2] = number;
-            ++number;
-            array[3] = static_cast<std::uint8_t>(fread(array + 4, 1, sizeOfPacket - 8, file));
-            ret = libusb_interrupt_transfer(amp_hand, 0x01, array, sizeOfPacket, &recieved, timeout.count());
-            libusb_interrupt_transfer(amp_hand, 0x81, array, sizeOfPacket, &recieved, timeout.count());
-            usleep(10000);
-
-            if (feof(file) != 0) // if reached end of the file
+            if (!device)
             {
-                break; // exit loop
+                return updateErrorNoDevice;
             }
-        }
-        fclose(file);
-
-        // send "finished" packet
-        memset(array, 0x00, sizeOfPacket);
-        array[0] = 0x04;
-        array[1] = 0x03;
-        libusb_interrupt_transfer(amp_hand, 0x01, array, sizeOfPacket, &recieved, timeout.count());
-        libusb_interrupt_transfer(amp_hand, 0x81, array, sizeOfPacket, &recieved, timeout.count());
-
-        closeUsb(amp_hand);
 
+            UsbComm connection{std::move(*device)};
+            sendFirmware(connection, image, progress);
+        }
+        catch (const usb::UsbException& ex)
+        {
+            return ex.code();
+        }
         return 0;
     }
+
+    int updateFirmware(const std::string& filename, const UpdateProgressHandler& progress)
+    {
+        std::optional<FirmwareImage> image;
+        try
+        {
+            image.emplace(loadFirmwareImage(filename));
+        }
+        catch (const std::invalid_argument&)
+        {
+            return updateErrorImage;
+        }
+        catch (const std::runtime_error&)
+        {
+            return updateErrorFile;
+        }
+        return updateFirmware(*image, progress);
+    }
 }
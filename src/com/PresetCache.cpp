@@ -0,0 +1,306 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "com/PresetCache.h"
+#include "com/IdLookup.h"
+#include "effects_enum.h"
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+
+namespace plug::com
+{
+    namespace
+    {
+        inline constexpr std::string_view fileHeader{"plug-preset-cache 1"};
+        inline constexpr std::size_t ampFields{17};
+        inline constexpr std::size_t effectFields{9};
+
+        std::string readRestOfLine(std::istringstream& line)
+        {
+            line.get(); // separator
+            std::string rest;
+            std::getline(line, rest);
+            return rest;
+        }
+
+        template <std::size_t n>
+        std::optional<std::array<int, n>> readFields(std::istringstream& line)
+        {
+            std::array<int, n> fields{};
+
+            for (auto& field : fields)
+            {
+                if (!(line >> field) || (field < 0) || (field > 0xff))
+                {
+                    return std::nullopt;
+                }
+            }
+            return fields;
+        }
+
+        std::uint8_t u8(int value)
+        {
+            return static_cast<std::uint8_t>(value);
+        }
+
+        // Models are stored by enum value, which is their index in the registry
+        template <class Model, std::size_t N>
+        bool isModel(const std::array<Model, N>& models, int value)
+        {
+            return static_cast<std::size_t>(value) < models.size();
+        }
+
+        void writeBank(std::ostream& stream, std::size_t slot, const SignalChain& signalChain)
+        {
+            const auto amp = signalChain.amp();
+            stream << "bank " << slot << ' ' << signalChain.name() << '\n'
+                   << "amp " << static_cast<int>(value(amp.amp_num)) << ' ' << int{amp.gain} << ' ' << int{amp.volume}
+                   << ' ' << int{amp.treble} << ' ' << int{amp.middle} << ' ' << int{amp.bass}
+                   << ' ' << static_cast<int>(value(amp.cabinet)) << ' ' << int{amp.noise_gate} << ' ' << int{amp.master_vol}
+                   << ' ' << int{amp.gain2} << ' ' << int{amp.presence} << ' ' << int{amp.threshold} << ' ' << int{amp.depth}
+                   << ' ' << int{amp.bias} << ' ' << int{amp.sag} << ' ' << int{amp.brightness} << ' ' << int{amp.usb_gain} << '\n';
+
+            const auto effects = signalChain.effects();
+            std::for_each(effects.cbegin(), effects.cend(), [&stream](const auto& e)
+                          { stream << "effect " << int{e.slot.id()} << ' ' << static_cast<int>(value(e.effect_num))
+                                   << ' ' << int{e.knob1} << ' ' << int{e.knob2} << ' ' << int{e.knob3}
+                                   << ' ' << int{e.knob4} << ' ' << int{e.knob5} << ' ' << int{e.knob6}
+                                   << ' ' << int{e.enabled} << '\n'; });
+        }
+
+        std::string toText(const SignalChain& signalChain)
+        {
+            std::ostringstream stream;
+            writeBank(stream, 0, signalChain);
+            return stream.str();
+        }
+
+        std::optional<amp_settings> readAmp(std::istringstream& line)
+        {
+            const auto f = readFields<ampFields>(line);
+
+            if (!f || !isModel(ampModels, (*f)[0]) || !isModel(cabinetModels, (*f)[6]))
+            {
+                return std::nullopt;
+            }
+            return amp_settings{static_cast<amps>((*f)[0]), u8((*f)[1]), u8((*f)[2]), u8((*f)[3]), u8((*f)[4]), u8((*f)[5]),
+                                static_cast<cabinets>((*f)[6]), u8((*f)[7]), u8((*f)[8]), u8((*f)[9]), u8((*f)[10]), u8((*f)[11]),
+                                u8((*f)[12]), u8((*f)[13]), u8((*f)[14]), (*f)[15] != 0, u8((*f)[16])};
+        }
+
+        std::optional<fx_pedal_settings> readEffect(std::istringstream& line)
+        {
+            const auto f = readFields<effectFields>(line);
+
+            if (!f || ((*f)[0] > 7) || !isModel(effectModels, (*f)[1]))
+            {
+                return std::nullopt;
+            }
+            return fx_pedal_settings{FxSlot{u8((*f)[0])}, static_cast<effects>((*f)[1]), u8((*f)[2]), u8((*f)[3]),
+                                     u8((*f)[4]), u8((*f)[5]), u8((*f)[6]), u8((*f)[7]), (*f)[8] != 0};
+        }
+    }
+
+
+    bool operator==(const DeviceIdentity& lhs, const DeviceIdentity& rhs)
+    {
+        return (lhs.vendorId == rhs.vendorId) && (lhs.productId == rhs.productId) && (lhs.name == rhs.name);
+    }
+
+
+    PresetCache::PresetCache(DeviceIdentity device)
+        : device_(std::move(device))
+    {
+    }
+
+    const DeviceIdentity& PresetCache::device() const
+    {
+        return device_;
+    }
+
+    const std::vector<std::string>& PresetCache::presetNames() const
+    {
+        return presetNames_;
+    }
+
+    bool PresetCache::setPresetNames(const std::vector<std::string>& names)
+    {
+        const bool changed = (names != presetNames_);
+        presetNames_ = names;
+
+        std::erase_if(banks_, [&names](const auto& bank)
+                      { return (bank.first >= names.size()) || (bank.second.name() != names[bank.first]); });
+        return changed;
+    }
+
+    std::optional<SignalChain> PresetCache::bank(std::size_t slot) const
+    {
+        if (const auto itr = banks_.find(slot); itr != banks_.end())
+        {
+            return itr->second;
+        }
+        return std::nullopt;
+    }
+
+    bool PresetCache::setBank(std::size_t slot, const SignalChain& signalChain)
+    {
+        bool changed = (slot < presetNames_.size()) && (presetNames_[slot] != signalChain.name());
+
+        if (changed)
+        {
+            presetNames_[slot] = signalChain.name();
+        }
+
+        if (const auto itr = banks_.find(slot); (itr == banks_.end()) || (toText(itr->second) != toText(signalChain)))
+        {
+            banks_.insert_or_assign(slot, signalChain);
+            changed = true;
+        }
+        return changed;
+    }
+
+    std::string PresetCache::fileName() const
+    {
+        std::ostringstream stream;
+        stream << std::hex << std::setfill('0') << std::setw(4) << device_.vendorId << '-' << std::setw(4) << device_.productId << '-';
+        std::transform(device_.name.cbegin(), device_.name.cend(), std::ostream_iterator<char>{stream}, [](char c)
+                       { return std::isalnum(static_cast<unsigned char>(c)) ? c : '_'; });
+        stream << ".cache";
+        return stream.str();
+    }
+
+    void PresetCache::write(std::ostream& stream) const
+    {
+        stream << fileHeader << '\n'
+               << "device " << device_.vendorId << ' ' << device_.productId << ' ' << device_.name << '\n';
+
+        for (std::size_t i = 0; i < presetNames_.size(); ++i)
+        {
+            stream << "preset " << i << ' ' << presetNames_[i] << '\n';
+        }
+
+        std::for_each(banks_.cbegin(), banks_.cend(), [&stream](const auto& bank)
+                      { writeBank(stream, bank.first, bank.second); });
+    }
+
+    std::optional<PresetCache> PresetCache::read(std::istream& stream, const DeviceIdentity& device)
+    {
+        std::string text;
+
+        if (!std::getline(stream, text) || (text != fileHeader))
+        {
+            return std::nullopt;
+        }
+
+        PresetCache cache{device};
+        bool deviceMatches{false};
+        std::optional<std::size_t> currentBank;
+
+        while (std::getline(stream, text))
+        {
+            std::istringstream line{text};
+            std::string key;
+            std::size_t slot{0};
+            line >> key;
+
+            if (key == "device")
+            {
+                DeviceIdentity stored{};
+                line >> stored.vendorId >> stored.productId;
+                stored.name = readRestOfLine(line);
+                deviceMatches = (stored == device);
+            }
+            else if ((key == "preset") && (line >> slot) && (slot == cache.presetNames_.size()))
+            {
+                cache.presetNames_.push_back(readRestOfLine(line));
+            }
+            else if ((key == "bank") && (line >> slot))
+            {
+                cache.banks_.insert_or_assign(slot, SignalChain{readRestOfLine(line), amp_settings{}, {}});
+                currentBank = slot;
+            }
+            else if ((key == "amp") && currentBank)
+            {
+                const auto amp = readAmp(line);
+
+                if (!amp)
+                {
+                    return std::nullopt;
+                }
+                cache.banks_.at(*currentBank).setAmp(*amp);
+            }
+            else if ((key == "effect") && currentBank)
+            {
+                const auto effect = readEffect(line);
+
+                if (!effect)
+                {
+                    return std::nullopt;
+                }
+                auto& bank = cache.banks_.at(*currentBank);
+                auto effects = bank.effects();
+                effects.push_back(*effect);
+                bank.setEffects(effects);
+            }
+            else
+            {
+                return std::nullopt;
+            }
+
+            if (!deviceMatches)
+            {
+                return std::nullopt;
+            }
+        }
+
+        if (!deviceMatches)
+        {
+            return std::nullopt;
+        }
+        return cache;
+    }
+
+
+    std::optional<PresetCache> loadPresetCache(const std::filesystem::path& directory, const DeviceIdentity& device)
+    {
+        std::ifstream file{directory / PresetCache{device}.fileName()};
+
+        if (!file)
+        {
+            return std::nullopt;
+        }
+        return PresetCache::read(file, device);
+    }
+
+    bool savePresetCache(const std::filesystem::path& directory, const PresetCache& cache)
+    {
+        std::error_code error;
+        std::filesystem::create_directories(directory, error);
+
+        std::ofstream file{directory / cache.fileName(), std::ios::trunc};
+        cache.write(file);
+        return static_cast<bool>(file);
+    }
+}
@@ -38,7 +38,7 @@ namespace plug::com
     }
 
     UsbComm::UsbComm(usb::Device device)
-        : device_(openDevice(std::move(device))), name_(device_.name())
+        : device_(openDevice(std::move(device))), events_(device_.context()), name_(device_.name())
     {
     }
 
@@ -57,13 +57,28 @@ namespace plug::com
         return device_.receive(endpointRecv, recvSize);
     }
 
+    std::future<std::vector<std::uint8_t>> UsbComm::receiveAsync(std::size_t recvSize)
+    {
+        return device_.receiveAsync(endpointRecv, recvSize);
+    }
+
     std::string UsbComm::name() const
     {
         return name_;
     }
 
-    std::size_t UsbComm::sendImpl(std::uint8_t* data, std::size_t size)
+    std::size_t UsbComm::sendImpl(const std::uint8_t* data, std::size_t size)
     {
         return device_.write(endpointSend, data, size);
     }
+
+    std::size_t UsbComm::receiveImpl(std::uint8_t* data, std::size_t size)
+    {
+        return device_.receive(endpointRecv, data, size);
+    }
+
+    std::future<std::size_t> UsbComm::receiveAsyncImpl(std::uint8_t* data, std::size_t size)
+    {
+        return device_.receiveAsync(endpointRecv, data, size);
+    }
 }
@@ -25,7 +25,30 @@
 
 namespace plug::com::usb
 {
+    namespace
+    {
+        int onHotplug([[maybe_unused]] libusb_context* ctx, libusb_device* device, libusb_hotplug_event event, void* userData)
+        {
+            const auto& dispatch = *static_cast<const std::function<void(Hotplug::Event, libusb_device*)>*>(userData);
+
+            try
+            {
+                dispatch(event == LIBUSB_HOTPLUG_EVENT_DEVICE_ARRIVED ? Hotplug::Event::arrived : Hotplug::Event::left, device);
+            }
+            catch (...)
+            {
+                // Nothing may unwind through the C callback of libusb; the
+                // device is missed like one that fails to open
+            }
+
+            // Keep the callback registered
+            return 0;
+        }
+    }
+
+
     Context::Context()
+        : context_(nullptr)
     {
         init();
     }
@@ -35,9 +58,14 @@ namespace plug::com::usb
         deinit();
     }
 
+    libusb_context* Context::get() const noexcept
+    {
+        return context_;
+    }
+
     void Context::init()
     {
-        if (const int status = libusb_init(nullptr); status != LIBUSB_SUCCESS)
+        if (const int status = libusb_init(&context_); status != LIBUSB_SUCCESS)
         {
             throw UsbException{status};
         }
@@ -45,14 +73,82 @@ namespace plug::com::usb
 
     void Context::deinit()
     {
-        libusb_exit(nullptr);
+        libusb_exit(context_);
+    }
+
+
+
+    EventLoop::EventLoop(std::shared_ptr<Context> context)
+        : context_(std::move(context)), running_(true), thread_([this] { run(); })
+    {
+    }
+
+    EventLoop::~EventLoop()
+    {
+        running_ = false;
+        libusb_interrupt_event_handler(context_->get());
+        thread_.join();
     }
 
+    void EventLoop::run()
+    {
+        while (running_)
+        {
+            timeval timeout{0, 100000};
+            libusb_handle_events_timeout_completed(context_->get(), &timeout, nullptr);
+        }
+    }
+
+
+    Hotplug::Hotplug(std::shared_ptr<Context> context, std::uint16_t vendorId, const std::vector<std::uint16_t>& productIds, Handler handler)
+        : context_(std::move(context)),
+          handler_(std::move(handler)),
+          dispatch_([this](Event event, libusb_device* device)
+                    { handler_(event, Device{device, context_}); }),
+          handles_(),
+          events_(context_)
+    {
+        handles_.reserve(productIds.size());
+
+        for (const auto pid : productIds)
+        {
+            libusb_hotplug_callback_handle handle{};
+            const int status = libusb_hotplug_register_callback(context_->get(),
+                                                                LIBUSB_HOTPLUG_EVENT_DEVICE_ARRIVED | LIBUSB_HOTPLUG_EVENT_DEVICE_LEFT,
+                                                                LIBUSB_HOTPLUG_ENUMERATE, vendorId, pid, LIBUSB_HOTPLUG_MATCH_ANY,
+                                                                onHotplug, &dispatch_, &handle);
+
+            if (status != LIBUSB_SUCCESS)
+            {
+                deregister();
+                throw UsbException{status};
+            }
+            handles_.push_back(handle);
+        }
+    }
+
+    Hotplug::~Hotplug()
+    {
+        deregister();
+    }
+
+    void Hotplug::deregister()
+    {
+        std::for_each(handles_.cbegin(), handles_.cend(), [this](auto handle)
+                      { libusb_hotplug_deregister_callback(context_->get(), handle); });
+        handles_.clear();
+    }
+
+
+    bool hasHotplug()
+    {
+        return libusb_has_capability(LIBUSB_CAP_HAS_HOTPLUG) != 0;
+    }
 
-    std::vector<Device> listDevices()
+    std::vector<Device> listDevices(std::shared_ptr<Context> context)
     {
         libusb_device** devices;
-        const auto n = libusb_get_device_list(nullptr, &devices);
+        const auto n = libusb_get_device_list(context->get(), &devices);
 
         if (n < 0)
         {
@@ -62,11 +158,11 @@ namespace plug::com::usb
         std::vector<Device> devicesFound;
         devicesFound.reserve(n);
 
-        std::for_each(devices, std::next(devices, n), [&devicesFound](auto* dev)
+        std::for_each(devices, std::next(devices, n), [&devicesFound, &context](auto* dev)
                       {
             try
             {
-                devicesFound.emplace_back(dev);
+                devicesFound.emplace_back(dev, context);
             }
             catch (const UsbException&)
             {
@@ -22,6 +22,8 @@
 #include "com/UsbException.h"
 #include <array>
 #include <chrono>
+#include <exception>
+#include <span>
 #include <libusb-1.0/libusb.h>
 
 namespace plug::com::usb
@@ -29,6 +31,101 @@ namespace plug::com::usb
     namespace
     {
         inline constexpr std::chrono::milliseconds usbTimeout{500};
+
+
+        template <class Result>
+        struct PendingTransfer
+        {
+            std::vector<std::uint8_t> buffer;
+            std::promise<Result> promise;
+            bool timeoutIsResult;
+        };
+
+        int toErrorCode(libusb_transfer_status status)
+        {
+            switch (status)
+            {
+                case LIBUSB_TRANSFER_TIMED_OUT:
+                    return LIBUSB_ERROR_TIMEOUT;
+                case LIBUSB_TRANSFER_CANCELLED:
+                    return LIBUSB_ERROR_INTERRUPTED;
+                case LIBUSB_TRANSFER_STALL:
+                    return LIBUSB_ERROR_PIPE;
+                case LIBUSB_TRANSFER_NO_DEVICE:
+                    return LIBUSB_ERROR_NO_DEVICE;
+                case LIBUSB_TRANSFER_OVERFLOW:
+                    return LIBUSB_ERROR_OVERFLOW;
+                default:
+                    return LIBUSB_ERROR_IO;
+            }
+        }
+
+        template <class Result>
+        Result toResult(std::vector<std::uint8_t>&& buffer, int transfered);
+
+        template <>
+        std::size_t toResult([[maybe_unused]] std::vector<std::uint8_t>&& buffer, int transfered)
+        {
+            return transfered;
+        }
+
+        template <>
+        std::vector<std::uint8_t> toResult(std::vector<std::uint8_t>&& buffer, int transfered)
+        {
+            buffer.resize(transfered);
+            return std::move(buffer);
+        }
+
+        template <class Result>
+        void onTransferCompleted(libusb_transfer* transfer)
+        {
+            Ressource<libusb_transfer, detail::releaseTransfer> owner{transfer};
+            std::unique_ptr<PendingTransfer<Result>> pending{static_cast<PendingTransfer<Result>*>(transfer->user_data)};
+
+            if ((transfer->status == LIBUSB_TRANSFER_COMPLETED) || ((transfer->status == LIBUSB_TRANSFER_TIMED_OUT) && pending->timeoutIsResult))
+            {
+                pending->promise.set_value(toResult<Result>(std::move(pending->buffer), transfer->actual_length));
+            }
+            else
+            {
+                pending->promise.set_exception(std::make_exception_ptr(UsbException{toErrorCode(transfer->status)}));
+            }
+        }
+
+        // The transfer reads from or writes into data, which is either the
+        // buffer owned by pending or one the caller keeps alive until completion
+        template <class Result>
+        std::future<Result> submitTransfer(libusb_device_handle* handle, std::uint8_t endpoint, std::unique_ptr<PendingTransfer<Result>> pending, std::uint8_t* data, std::size_t dataSize)
+        {
+            Ressource<libusb_transfer, detail::releaseTransfer> transfer{libusb_alloc_transfer(0)};
+
+            if (transfer == nullptr)
+            {
+                throw UsbException{LIBUSB_ERROR_NO_MEM};
+            }
+
+            auto result = pending->promise.get_future();
+            libusb_fill_interrupt_transfer(transfer.get(), handle, endpoint, data, dataSize,
+                                           onTransferCompleted<Result>, pending.get(), usbTimeout.count());
+
+            if (const int status = libusb_submit_transfer(transfer.get()); status != LIBUSB_SUCCESS)
+            {
+                throw UsbException{status};
+            }
+
+            pending.release();
+            transfer.release();
+            return result;
+        }
+
+        template <class Result>
+        std::future<Result> submitTransfer(libusb_device_handle* handle, std::uint8_t endpoint, std::vector<std::uint8_t> buffer, bool timeoutIsResult)
+        {
+            auto pending = std::make_unique<PendingTransfer<Result>>(std::move(buffer), std::promise<Result>{}, timeoutIsResult);
+            auto* data = pending->buffer.data();
+            const auto dataSize = pending->buffer.size();
+            return submitTransfer<Result>(handle, endpoint, std::move(pending), data, dataSize);
+        }
     }
 
     namespace detail
@@ -43,11 +140,16 @@ namespace plug::com::usb
             libusb_release_interface(handle, 0);
             libusb_close(handle);
         }
+
+        void releaseTransfer(libusb_transfer* transfer)
+        {
+            libusb_free_transfer(transfer);
+        }
     }
 
 
-    Device::Device(libusb_device* device)
-        : device_(libusb_ref_device(device)), handle_(nullptr), descriptor_(getDeviceDescriptor(device))
+    Device::Device(libusb_device* device, std::shared_ptr<Context> context)
+        : context_(std::move(context)), device_(libusb_ref_device(device)), handle_(nullptr), descriptor_(getDeviceDescriptor(device))
     {
     }
 
@@ -104,11 +206,39 @@ namespace plug::com::usb
         return std::string{buffer.cbegin(), std::next(buffer.cbegin(), n)};
     }
 
-    std::size_t Device::write(std::uint8_t endpoint, std::uint8_t* data, std::size_t dataSize)
+    std::string Device::location() const
+    {
+        // USB allows up to 7 tiers
+        std::array<std::uint8_t, 7> ports{{}};
+        const int n = libusb_get_port_numbers(device_.get(), ports.data(), ports.size());
+
+        if (n < 0)
+        {
+            throw UsbException{n};
+        }
+
+        std::string path = std::to_string(libusb_get_bus_number(device_.get()));
+        char separator = '-';
+
+        for (const auto port : std::span{ports}.first(static_cast<std::size_t>(n)))
+        {
+            path += separator + std::to_string(port);
+            separator = '.';
+        }
+        return path;
+    }
+
+    std::shared_ptr<Context> Device::context() const
+    {
+        return context_;
+    }
+
+    std::size_t Device::write(std::uint8_t endpoint, const std::uint8_t* data, std::size_t dataSize)
     {
         int transfered{0};
 
-        if (const auto result = libusb_interrupt_transfer(handle_.get(), endpoint, data, dataSize, &transfered, usbTimeout.count()); result != LIBUSB_SUCCESS)
+        // OUT transfers only read from the buffer, libusb lacks the const qualifier
+        if (const auto result = libusb_interrupt_transfer(handle_.get(), endpoint, const_cast<std::uint8_t*>(data), dataSize, &transfered, usbTimeout.count()); result != LIBUSB_SUCCESS)
         {
             throw UsbException{result};
         }
@@ -118,14 +248,35 @@ namespace plug::com::usb
     std::vector<std::uint8_t> Device::receive(std::uint8_t endpoint, std::size_t dataSize)
     {
         std::vector<std::uint8_t> buffer(dataSize);
+        buffer.resize(receive(endpoint, buffer.data(), dataSize));
+        return buffer;
+    }
+
+    std::size_t Device::receive(std::uint8_t endpoint, std::uint8_t* data, std::size_t dataSize)
+    {
         int transfered{0};
 
-        if (const auto result = libusb_interrupt_transfer(handle_.get(), endpoint, buffer.data(), dataSize, &transfered, usbTimeout.count()); (result != LIBUSB_SUCCESS) && (result != LIBUSB_ERROR_TIMEOUT))
+        if (const auto result = libusb_interrupt_transfer(handle_.get(), endpoint, data, dataSize, &transfered, usbTimeout.count()); (result != LIBUSB_SUCCESS) && (result != LIBUSB_ERROR_TIMEOUT))
         {
             throw UsbException{result};
         }
-        buffer.resize(transfered);
-        return buffer;
+        return transfered;
+    }
+
+    std::future<std::size_t> Device::writeAsync(std::uint8_t endpoint, const std::uint8_t* data, std::size_t dataSize)
+    {
+        return submitTransfer<std::size_t>(handle_.get(), endpoint, std::vector<std::uint8_t>(data, std::next(data, dataSize)), false);
+    }
+
+    std::future<std::vector<std::uint8_t>> Device::receiveAsync(std::uint8_t endpoint, std::size_t dataSize)
+    {
+        return submitTransfer<std::vector<std::uint8_t>>(handle_.get(), endpoint, std::vector<std::uint8_t>(dataSize), true);
+    }
+
+    std::future<std::size_t> Device::receiveAsync(std::uint8_t endpoint, std::uint8_t* data, std::size_t dataSize)
+    {
+        auto pending = std::make_unique<PendingTransfer<std::size_t>>(std::vector<std::uint8_t>{}, std::promise<std::size_t>{}, true);
+        return submitTransfer<std::size_t>(handle_.get(), endpoint, std::move(pending), data, dataSize);
     }
 
     Device::Descriptor Device::getDeviceDescriptor(libusb_device* device) const
@@ -55,6 +55,22 @@ namespace plug
         settings.setValue("Windows/amplifierAdvancedWindowGeometry", saveGeometry());
     }
 
+    void Amp_Advanced::load(const amp_settings& settings)
+    {
+        change_cabinet(value(settings.cabinet));
+        change_noise_gate(settings.noise_gate);
+
+        set_master_vol(settings.master_vol);
+        set_gain2(settings.gain2);
+        set_presence(settings.presence);
+        set_depth(settings.depth);
+        set_threshold(settings.threshold);
+        set_bias(settings.bias);
+        set_sag(settings.sag);
+        set_brightness(settings.brightness);
+        set_usb_gain(settings.usb_gain);
+    }
+
     void Amp_Advanced::change_cabinet(int value)
     {
         ui->comboBox->setCurrentIndex(value);
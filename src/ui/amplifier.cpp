@@ -70,7 +70,6 @@ namespace plug
           bias(128),
           sag(1),
           usb_gain(0),
-          changed(false),
           brightness(false)
     {
         ui->setupUi(this);
@@ -88,6 +87,11 @@ namespace plug
         connect(ui->dial_3, SIGNAL(valueChanged(int)), this, SLOT(set_treble(int)));
         connect(ui->dial_4, SIGNAL(valueChanged(int)), this, SLOT(set_middle(int)));
         connect(ui->dial_5, SIGNAL(valueChanged(int)), this, SLOT(set_bass(int)));
+        connect(ui->dial, SIGNAL(valueChanged(int)), this, SLOT(send_live()));
+        connect(ui->dial_2, SIGNAL(valueChanged(int)), this, SLOT(send_live()));
+        connect(ui->dial_3, SIGNAL(valueChanged(int)), this, SLOT(send_live()));
+        connect(ui->dial_4, SIGNAL(valueChanged(int)), this, SLOT(send_live()));
+        connect(ui->dial_5, SIGNAL(valueChanged(int)), this, SLOT(send_live()));
         connect(ui->setButton, SIGNAL(clicked()), this, SLOT(send_amp()));
 
         QShortcut* close = new QShortcut(QKeySequence(Qt::Key_Escape), this);
@@ -111,103 +115,103 @@ namespace plug
     void Amplifier::set_gain(int value)
     {
         gain = static_cast<std::uint8_t>(value);
-        changed = true;
+        edits.setChanged(true);
     }
 
     void Amplifier::set_volume(int value)
     {
         volume = static_cast<std::uint8_t>(value);
-        changed = true;
+        edits.setChanged(true);
     }
 
     void Amplifier::set_treble(int value)
     {
         treble = static_cast<std::uint8_t>(value);
-        changed = true;
+        edits.setChanged(true);
     }
 
     void Amplifier::set_middle(int value)
     {
         middle = static_cast<std::uint8_t>(value);
-        changed = true;
+        edits.setChanged(true);
     }
 
     void Amplifier::set_bass(int value)
     {
         bass = static_cast<std::uint8_t>(value);
-        changed = true;
+        edits.setChanged(true);
     }
 
     void Amplifier::set_cabinet(int value)
     {
         cabinet = static_cast<cabinets>(value);
-        changed = true;
+        edits.setChanged(true);
     }
 
     void Amplifier::set_noise_gate(int value)
     {
         noise_gate = static_cast<std::uint8_t>(value);
-        changed = true;
+        edits.setChanged(true);
     }
 
     void Amplifier::set_presence(int value)
     {
         presence = static_cast<std::uint8_t>(value);
-        changed = true;
+        edits.setChanged(true);
     }
 
     void Amplifier::set_gain2(int value)
     {
         gain2 = static_cast<std::uint8_t>(value);
-        changed = true;
+        edits.setChanged(true);
     }
 
     void Amplifier::set_master_vol(int value)
     {
         master_vol = static_cast<std::uint8_t>(value);
-        changed = true;
+        edits.setChanged(true);
     }
 
     void Amplifier::set_threshold(int value)
     {
         threshold = static_cast<std::uint8_t>(value);
-        changed = true;
+        edits.setChanged(true);
     }
 
     void Amplifier::set_depth(int value)
     {
         depth = static_cast<std::uint8_t>(value);
-        changed = true;
+        edits.setChanged(true);
     }
 
     void Amplifier::set_bias(int value)
     {
         bias = static_cast<std::uint8_t>(value);
-        changed = true;
+        edits.setChanged(true);
     }
 
     void Amplifier::set_sag(int value)
     {
         sag = static_cast<std::uint8_t>(value);
-        changed = true;
+        edits.setChanged(true);
     }
 
     void Amplifier::set_brightness(bool value)
     {
         brightness = value;
-        changed = true;
+        edits.setChanged(true);
     }
 
     void Amplifier::set_usb_gain(int value)
     {
         usb_gain = static_cast<std::uint8_t>(value);
-        changed = true;
+        edits.setChanged(true);
     }
 
     void Amplifier::choose_amp(int ampValue)
     {
         amp_num = static_cast<amps>(ampValue);
-        changed = true;
+        edits.setChanged(true);
 
         const auto title = QString::fromStdString("Amplifier: " + ampNames.at(amp_num));
         setWindowTitle(title);
@@ -290,11 +294,10 @@ namespace plug
     {
         amp_settings settings{};
 
-        if (!changed)
+        if (!edits.takeChanges())
         {
             return;
         }
-        changed = false;
 
         settings.amp_num = amp_num;
         settings.gain = gain;
@@ -317,29 +320,31 @@ namespace plug
         dynamic_cast<MainWindow*>(parent())->set_amplifier(settings);
     }
 
+    // stream the dial positions to the amplifier while they're changing
+    void Amplifier::send_live()
+    {
+        if (edits.populating())
+        {
+            return;
+        }
+
+        amp_settings settings{};
+        get_settings(&settings);
+        dynamic_cast<MainWindow*>(parent())->set_amplifier_live(settings);
+    }
+
     void Amplifier::load(amp_settings settings)
     {
-        changed = true;
-
-        ui->comboBox->setCurrentIndex(value(settings.amp_num));
-        ui->dial->setValue(settings.gain);
-        ui->dial_2->setValue(settings.volume);
-        ui->dial_3->setValue(settings.treble);
-        ui->dial_4->setValue(settings.middle);
-        ui->dial_5->setValue(settings.bass);
-
-        advanced->change_cabinet(value(settings.cabinet));
-        advanced->change_noise_gate(settings.noise_gate);
-
-        advanced->set_master_vol(settings.master_vol);
-        advanced->set_gain2(settings.gain2);
-        advanced->set_presence(settings.presence);
-        advanced->set_depth(settings.depth);
-        advanced->set_threshold(settings.threshold);
-        advanced->set_bias(settings.bias);
-        advanced->set_sag(settings.sag);
-        advanced->set_brightness(settings.brightness);
-        advanced->set_usb_gain(settings.usb_gain);
+        edits.populate([this, &settings]
+                       {
+            ui->comboBox->setCurrentIndex(value(settings.amp_num));
+            ui->dial->setValue(settings.gain);
+            ui->dial_2->setValue(settings.volume);
+            ui->dial_3->setValue(settings.treble);
+            ui->dial_4->setValue(settings.middle);
+            ui->dial_5->setValue(settings.bass);
+
+            advanced->load(settings); });
     }
 
     void Amplifier::get_settings(amp_settings* settings)
@@ -0,0 +1,100 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ui/effect_knobs.h"
+#include "EffectModel.h"
+#include <QCoreApplication>
+#include <QDial>
+#include <QLabel>
+#include <QSpinBox>
+
+namespace plug
+{
+    namespace
+    {
+        QString translate(const char* text)
+        {
+            return QCoreApplication::translate("EffectModel", text);
+        }
+
+        KnobTexts knobTexts(const KnobInfo& knob, const KnobTextFormat& format)
+        {
+            if (knob.max == 0)
+            {
+                return KnobTexts{
+                    QString{},
+                    QCoreApplication::translate("EffectKnobs", "Disabled dial"),
+                    QCoreApplication::translate("EffectKnobs", "This dial is disabled in this effect"),
+                    QCoreApplication::translate("EffectKnobs", "Disabled box"),
+                    QCoreApplication::translate("EffectKnobs", "This box is disabled in this effect")};
+            }
+
+            const auto name = translate(knob.name);
+            return KnobTexts{
+                translate(knob.label),
+                format.dialName.arg(name),
+                QCoreApplication::translate("EffectKnobs", "Allows you to set \"%1\" parameter of this effect").arg(name),
+                format.spinBoxName.arg(name),
+                QCoreApplication::translate("EffectKnobs", "Allows you to precisely set \"%1\" parameter of this effect").arg(name)};
+        }
+    }
+
+
+    void showEffectKnobs(const EffectKnobWidgets& widgets, effects effect, const KnobTextFormat& format, bool resetUnused)
+    {
+        const auto& knobs = effectModel(effect).knobs;
+
+        for (std::size_t i = 0; i < knobs.size(); ++i)
+        {
+            const auto& widget = widgets[i];
+            const auto max = knobs[i].max;
+
+            if (max > 0)
+            {
+                widget.dial->setMaximum(max);
+                widget.spinBox->setMaximum(max);
+            }
+            else if (resetUnused)
+            {
+                widget.dial->setValue(0);
+            }
+            widget.dial->setDisabled(max == 0);
+            widget.spinBox->setDisabled(max == 0);
+
+            const auto texts = (effect == effects::EMPTY) ? format.empty[i] : knobTexts(knobs[i], format);
+            widget.label->setText(texts.label);
+            widget.dial->setAccessibleName(texts.dialName);
+            widget.dial->setAccessibleDescription(texts.dialDescription);
+            widget.spinBox->setAccessibleName(texts.spinBoxName);
+            widget.spinBox->setAccessibleDescription(texts.spinBoxDescription);
+        }
+    }
+
+    void enableEffectKnobs(const EffectKnobWidgets& widgets, effects effect)
+    {
+        const auto& knobs = effectModel(effect).knobs;
+
+        for (std::size_t i = 0; i < knobs.size(); ++i)
+        {
+            widgets[i].dial->setDisabled(knobs[i].max == 0);
+            widgets[i].spinBox->setDisabled(knobs[i].max == 0);
+        }
+    }
+}
@@ -62,19 +62,19 @@ namespace plug
 
     void LoadFromAmp::load_names(const std::vector<std::string>& names)
     {
-        std::size_t index{1};
+        std::size_t index{0};
         std::for_each(names.cbegin(), names.cend(), [&index, this](const auto& name)
-                      {
-                ui->comboBox->addItem(QString("[%1] %2").arg(index).arg(QString::fromStdString(name)));
-                ++index; });
+                      { add_name(index++, name); });
+    }
+
+    void LoadFromAmp::add_name(std::size_t index, const std::string& name)
+    {
+        ui->comboBox->addItem(QString("[%1] %2").arg(index + 1).arg(QString::fromStdString(name)));
     }
 
     void LoadFromAmp::delete_items()
     {
-        for (int i = 0; i < ui->comboBox->count(); ++i)
-        {
-            ui->comboBox->removeItem(0);
-        }
+        ui->comboBox->clear();
     }
 
     void LoadFromAmp::change_name(int slot, QString* name)
@@ -32,45 +32,30 @@
 #include "ui/savetofile.h"
 #include "ui/settings.h"
 #include "com/Mustang.h"
+#include "com/AsyncMustang.h"
+#include "com/LiveUpdater.h"
 #include "com/ConnectionFactory.h"
 #include "com/CommunicationException.h"
 #include "com/MustangUpdater.h"
+#include "EffectModel.h"
 #include "ui_defaulteffects.h"
 #include "ui_mainwindow.h"
 #include <algorithm>
+#include <type_traits>
 #include <QFileDialog>
 #include <QMessageBox>
 #include <QSettings>
 #include <QShortcut>
+#include <QStandardPaths>
 #include <QDebug>
 
 namespace plug
 {
     namespace
     {
-        constexpr int check_fx_family(effects value)
+        std::filesystem::path presetCacheDirectory()
         {
-            if (value == effects::EMPTY)
-            {
-                return 0;
-            }
-            if ((value >= effects::OVERDRIVE) && (value <= effects::COMPRESSOR))
-            {
-                return 1;
-            }
-            if ((value >= effects::SINE_CHORUS) && (value <= effects::PITCH_SHIFTER))
-            {
-                return 2;
-            }
-            if ((value >= effects::MONO_DELAY) && (value <= effects::STEREO_TAPE_DELAY))
-            {
-                return 3;
-            }
-            if ((value >= effects::SMALL_HALL_REVERB) && (value <= effects::FENDER_65_SPRING_REVERB))
-            {
-                return 4;
-            }
-            return 0;
+            return QStandardPaths::writableLocation(QStandardPaths::CacheLocation).toStdString();
         }
 
     }
@@ -81,6 +66,10 @@ namespace plug
           ui(std::make_unique<Ui::MainWindow>()),
           presetNames(100, ""),
           amp_ops(nullptr),
+          ampSession(0),
+          liveUpdater(nullptr),
+          hotplug(nullptr),
+          lostAmpIdentity{},
           effectComponents{{new Effect{this, FxSlot{0}},
                             new Effect{this, FxSlot{1}},
                             new Effect{this, FxSlot{2}},
@@ -220,8 +209,14 @@ namespace plug
         QShortcut* shortcut = new QShortcut(QKeySequence(Qt::CTRL | Qt::SHIFT | Qt::Key_A), this);
         connect(shortcut, SIGNAL(activated()), this, SLOT(enable_buttons()));
 
-        // connect the functions if needed
-        if (settings.value("Settings/connectOnStartup").toBool())
+        // show the presets of the last device until it's connected
+        restore_preset_cache();
+
+        // connect the functions if needed; with hotplug support the amp is
+        // connected once it's reported
+        watch_amps();
+
+        if (!hotplug && settings.value("Settings/connectOnStartup").toBool())
         {
             connect(this, SIGNAL(started()), this, SLOT(start_amp()));
         }
@@ -237,6 +232,11 @@ namespace plug
         QSettings settings;
         settings.setValue("Windows/mainWindowGeometry", saveGeometry());
         settings.setValue("Windows/mainWindowState", saveState());
+
+        // The released amps have to be closed before the application quits
+        release_amp();
+        std::for_each(ampReleases.cbegin(), ampReleases.cend(), [](const auto& release)
+                      { release.wait(); });
     }
 
     void MainWindow::about()
@@ -259,116 +259,306 @@ namespace plug
     }
 
 
+    // Runs the command on the worker thread of the amp; the result (or error)
+    // is passed back to the GUI thread. It's dropped there if the amp was lost
+    // or reconnected in the meantime.
+    template <class Command, class Done>
+    void MainWindow::run_on_amp(Command command, Done done)
+    {
+        if (amp_ops == nullptr)
+        {
+            return;
+        }
+
+        amp_ops->run([this, session = ampSession, command = std::move(command), done = std::move(done)](com::Mustang& device) mutable
+                     {
+            try
+            {
+                if constexpr (std::is_void_v<std::invoke_result_t<Command, com::Mustang&>>)
+                {
+                    command(device);
+                    QMetaObject::invokeMethod(this, [this, session, done = std::move(done)]
+                                              {
+                                                  if (session == ampSession)
+                                                  {
+                                                      done();
+                                                  } }, Qt::QueuedConnection);
+                }
+                else
+                {
+                    QMetaObject::invokeMethod(this, [this, session, done = std::move(done), result = command(device)]
+                                              {
+                                                  if (session == ampSession)
+                                                  {
+                                                      done(result);
+                                                  } }, Qt::QueuedConnection);
+                }
+            }
+            catch (const std::exception& ex)
+            {
+                QMetaObject::invokeMethod(this, [this, session, message = QString{ex.what()}]
+                                          {
+                                              if (session == ampSession)
+                                              {
+                                                  show_error(message);
+                                              } }, Qt::QueuedConnection);
+            } });
+    }
+
     void MainWindow::start_amp()
     {
-        QSettings settings;
-        amp_settings amplifier_set{};
-        std::vector<fx_pedal_settings> effects_set{};
-        QString name;
+        connect_amp(nullptr);
+    }
 
+    void MainWindow::connect_amp(std::shared_ptr<com::usb::Device> device)
+    {
         ui->statusBar->showMessage(tr("Connecting..."));
-        this->repaint(); // this should not be needed!
+        ui->actionConnect->setDisabled(true);
+
+        load->delete_items();
+        save->delete_items();
+        quickpres->delete_items();
+        presetNames.clear();
+        release_amp();
+        const auto session = ampSession;
+
+        // changes made on the amp are reported on the listening thread
+        const auto eventHandler = [this, session](const com::AmpEvent& ampEvent)
+        {
+            QMetaObject::invokeMethod(this, [this, session, ampEvent]
+                                      {
+                                          if (session == ampSession)
+                                          {
+                                              show_amp_event(ampEvent);
+                                          } }, Qt::QueuedConnection);
+        };
 
         try
         {
-            amp_ops = plug::com::connect();
-            const auto [signalChain, presets] = amp_ops->start_amp();
-            name = QString::fromStdString(signalChain.name());
-            amplifier_set = signalChain.amp();
-            effects_set = signalChain.effects();
-            presetNames = presets;
+            amp_ops = std::make_unique<com::AsyncMustang>(device ? plug::com::connect(std::move(*device), eventHandler)
+                                                                 : plug::com::connect(eventHandler));
         }
         catch (const std::exception& ex)
         {
-            qWarning() << "ERROR: " << ex.what();
-            ui->statusBar->showMessage(QString(tr("Error: %1")).arg(ex.what()), 5000);
+            show_error(QString{ex.what()});
             return;
         }
 
-        load->load_names(presetNames);
-        save->load_names(presetNames);
-        quickpres->load_names(presetNames);
+        amp->setDeviceModel(amp_ops->getDeviceModel());
+
+        // show the data as it arrives instead of waiting for the whole transfer;
+        // the observer is called on the worker thread
+        auto stateShown = std::make_shared<bool>(false);
+        const com::StartObserver observer{[this, session](std::size_t index, const std::string& presetName)
+                                          {
+                                              QMetaObject::invokeMethod(this, [this, session, index, presetName]
+                                                                        {
+                                                                            if (session == ampSession)
+                                                                            {
+                                                                                add_preset_name(index, presetName);
+                                                                            } }, Qt::QueuedConnection);
+                                          },
+                                          [this, session, stateShown](const SignalChain& signalChain)
+                                          {
+                                              QMetaObject::invokeMethod(this, [this, session, stateShown, signalChain]
+                                                                        {
+                                                                            if (session == ampSession)
+                                                                            {
+                                                                                show_current_preset(signalChain);
+                                                                                *stateShown = true;
+                                                                            } }, Qt::QueuedConnection);
+                                          }};
+
+        run_on_amp([observer](com::Mustang& device)
+                   { return device.start_amp(observer); },
+                   [this, stateShown](const com::InitialData& data)
+                   {
+                       if (*stateShown == false)
+                       {
+                           show_current_preset(data.signalChain);
+                       }
+                       presetNames = data.presetNames;
+                       quickpres->load_names(presetNames);
+                       update_preset_cache(presetNames);
+
+                       // activate buttons
+                       amp->enable_set_button(true);
+                       std::for_each(effectComponents.cbegin(), effectComponents.cend(), [](const auto& effect)
+                                     { effect->enable_set_button(true); });
+                       ui->actionDisconnect->setDisabled(false);
+                       ui->actionSave_to_amplifier->setDisabled(false);
+                       ui->action_Load_from_amplifier->setDisabled(false);
+                       ui->actionSave_effects->setDisabled(false);
+                       ui->action_Library_view->setDisabled(false);
+                       ui->statusBar->showMessage(tr("Connected"), 3000);
+
+                       connected = true;
+                       start_live_updates();
+                       restore_signal_chain();
+                   });
+    }
+
+    void MainWindow::stop_amp()
+    {
+        save->delete_items();
+        load->delete_items();
+        quickpres->delete_items();
+        connected = false;
+        release(std::move(liveUpdater), nullptr);
+
+        run_on_amp([](com::Mustang& device)
+                   { device.stop_amp(); },
+                   [this]
+                   { show_disconnected(tr("Disconnected")); });
+    }
+
+    void MainWindow::show_disconnected(const QString& message)
+    {
+        // deactivate buttons
+        amp->enable_set_button(false);
+        std::for_each(effectComponents.cbegin(), effectComponents.cend(), [](const auto& effect)
+                      { effect->enable_set_button(false); });
+        ui->actionConnect->setDisabled(false);
+        ui->actionDisconnect->setDisabled(true);
+        ui->actionSave_to_amplifier->setDisabled(true);
+        ui->action_Load_from_amplifier->setDisabled(true);
+        ui->actionSave_effects->setDisabled(true);
+        ui->action_Library_view->setDisabled(true);
+        setWindowTitle(QString(tr("PLUG")));
+        setAccessibleName(QString(tr("Main window: None")));
+        ui->statusBar->showMessage(message, 5000);
+
+        show_cached_presets();
+    }
 
-        if (name.isEmpty() == true)
+    void MainWindow::watch_amps()
+    {
+        try
         {
-            setWindowTitle(QString(tr("PLUG: NONE")));
-            setAccessibleName(QString(tr("Main window: NONE")));
+            // called on this thread for amps already present and on the USB event
+            // thread afterwards; either way the device is opened later through
+            // the event queue of the GUI thread
+            hotplug = com::watchAmps([this](com::usb::Hotplug::Event event, com::usb::Device device)
+                                     {
+                                         auto shared = std::make_shared<com::usb::Device>(std::move(device));
+                                         QMetaObject::invokeMethod(this, [this, event, shared]
+                                                                   { amp_plugged(event, shared); }, Qt::QueuedConnection);
+                                     });
         }
-        else
+        catch (const std::exception& ex)
         {
-            const auto model = amp_ops->getDeviceModel();
-            setWindowTitle(QString(tr("PLUG - %1 %2: %3"))
-                               .arg(QString::fromStdString(model.name()))
-                               .arg(model.category() == DeviceModel::Category::MustangV2 ? "(v2)" : "")
-                               .arg(name));
-            setAccessibleName(QString(tr("Main window: %1")).arg(name));
+            show_error(QString{ex.what()});
         }
+    }
 
-        current_name = name;
+    void MainWindow::amp_plugged(com::usb::Hotplug::Event event, std::shared_ptr<com::usb::Device> device)
+    {
+        QSettings settings;
 
-        amp->setDeviceModel(amp_ops->getDeviceModel());
-        amp->load(amplifier_set);
-        if (settings.value("Settings/popupChangedWindows").toBool())
+        if (event == com::usb::Hotplug::Event::left)
         {
-            amp->show();
+            if (amp_ops && is_current_amp(*device))
+            {
+                amp_lost();
+            }
+            return;
         }
 
-        std::for_each(effects_set.cbegin(), effects_set.cend(), [this, &settings](const auto& effect)
-                      {
-            Effect* component = effectComponents.at(effect.slot.id());
-            component->load(effect);
-
-            if ((effect.effect_num != effects::EMPTY) && (settings.value("Settings/popupChangedWindows").toBool()))
-            {
-                component->show();
-            } });
-        // activate buttons
-        amp->enable_set_button(true);
-        std::for_each(effectComponents.cbegin(), effectComponents.cend(), [](const auto& effect)
-                      { effect->enable_set_button(true); });
-        ui->actionConnect->setDisabled(true);
-        ui->actionDisconnect->setDisabled(false);
-        ui->actionSave_to_amplifier->setDisabled(false);
-        ui->action_Load_from_amplifier->setDisabled(false);
-        ui->actionSave_effects->setDisabled(false);
-        ui->action_Library_view->setDisabled(false);
-        ui->statusBar->showMessage(tr("Connected"), 3000);
+        // connected or still connecting
+        if (connected || !ui->actionConnect->isEnabled() || !settings.value("Settings/connectOnStartup").toBool())
+        {
+            return;
+        }
+        connect_amp(std::move(device));
+    }
 
-        connected = true;
+    // Other amps may come and go while connected; only the one in use ends the
+    // session. A device that has left can't be opened to read its name, so it's
+    // told apart by where it was plugged in.
+    bool MainWindow::is_current_amp(const com::usb::Device& device) const
+    {
+        const auto identity = amp_ops->getDeviceIdentity();
+        return (device.vendorId() == identity.vendorId) && (device.productId() == identity.productId)
+               && (device.location() == identity.location);
     }
 
-    void MainWindow::stop_amp()
+    // The amp is gone, so there's nothing to send anymore; its state is kept
+    // to be restored once it's back.
+    void MainWindow::amp_lost()
     {
+        if (connected && amp_ops)
+        {
+            amp_settings ampSettings{};
+            std::vector<fx_pedal_settings> effectSettings;
+            get_settings(&ampSettings, effectSettings);
+            lostSignalChain = SignalChain{current_name.toStdString(), ampSettings, effectSettings};
+            lostAmpIdentity = amp_ops->getDeviceIdentity();
+        }
+
+        connected = false;
+        release_amp();
         save->delete_items();
         load->delete_items();
         quickpres->delete_items();
+        show_disconnected(tr("Amp disconnected"));
+    }
 
-        try
+    // Ends the session of the current amp; the results of commands still
+    // queued for it are dropped as they belong to an old session.
+    void MainWindow::release_amp()
+    {
+        ++ampSession;
+        release(std::move(liveUpdater), std::move(amp_ops));
+    }
+
+    // Commands still queued may take a while, so the live updater and the
+    // worker are joined off the GUI thread. Releases still running are kept
+    // until they are done, each one waits for its predecessor; this way a
+    // live updater is always gone before the amp it sends to.
+    void MainWindow::release(std::unique_ptr<com::LiveUpdater> updater, std::unique_ptr<com::AsyncMustang> device)
+    {
+        if (updater == nullptr && device == nullptr)
         {
-            amp_ops->stop_amp();
+            return;
+        }
 
-            // deactivate buttons
-            amp->enable_set_button(false);
-            std::for_each(effectComponents.cbegin(), effectComponents.cend(), [](const auto& effect)
-                          { effect->enable_set_button(false); });
-            ui->actionConnect->setDisabled(false);
-            ui->actionDisconnect->setDisabled(true);
-            ui->actionSave_to_amplifier->setDisabled(true);
-            ui->action_Load_from_amplifier->setDisabled(true);
-            ui->actionSave_effects->setDisabled(true);
-            ui->action_Library_view->setDisabled(true);
-            setWindowTitle(QString(tr("PLUG")));
-            setAccessibleName(QString(tr("Main window: None")));
-            ui->statusBar->showMessage(tr("Disconnected"), 5000);
+        ampReleases.erase(std::remove_if(ampReleases.begin(), ampReleases.end(), [](const auto& release)
+                                         { return release.wait_for(std::chrono::seconds{0}) == std::future_status::ready; }),
+                          ampReleases.end());
+
+        const auto previous = ampReleases.empty() ? std::shared_future<void>{} : ampReleases.back();
+        ampReleases.push_back(std::async(std::launch::async, [previous, updater = std::move(updater), device = std::move(device)]() mutable
+                                         {
+                                             if (previous.valid())
+                                             {
+                                                 previous.wait();
+                                             }
+                                             updater.reset();
+                                             device.reset(); })
+                                  .share());
+    }
 
-            connected = false;
+    void MainWindow::restore_signal_chain()
+    {
+        if (!lostSignalChain)
+        {
+            return;
         }
-        catch (const std::exception& ex)
+
+        const auto signalChain = *lostSignalChain;
+        lostSignalChain.reset();
+
+        // the settings belong to the amp that was lost, not to any other one
+        if (!amp_ops || (amp_ops->getDeviceIdentity() != lostAmpIdentity))
         {
-            qWarning() << "ERROR: " << ex.what();
-            ui->statusBar->showMessage(QString(tr("Error: %1")).arg(ex.what()), 5000);
             return;
         }
+        show_signal_chain(signalChain);
+
+        run_on_amp([signalChain](com::Mustang& device)
+                   { return device.apply(signalChain); },
+                   [this](std::size_t)
+                   { ui->statusBar->showMessage(tr("Reconnected, settings restored"), 3000); });
     }
 
     // pass the message to the amp
@@ -383,16 +573,9 @@ namespace plug
 
         if (!settings.value("Settings/oneSetToSetThemAll").toBool())
         {
-            try
-            {
-                amp_ops->set_effect(pedal);
-            }
-            catch (const std::exception& ex)
-            {
-                qWarning() << "ERROR: " << ex.what();
-                ui->statusBar->showMessage(QString(tr("Error: %1")).arg(ex.what()), 5000);
-                return;
-            }
+            run_on_amp([pedal](com::Mustang& device)
+                       { device.set_effect(pedal); },
+                       [] {});
         }
         amp->send_amp();
     }
@@ -405,26 +588,42 @@ namespace plug
         }
 
         QSettings settings;
+        com::CommandBatch batch;
 
-        try
+        if (settings.value("Settings/oneSetToSetThemAll").toBool())
         {
-            if (settings.value("Settings/oneSetToSetThemAll").toBool())
-            {
-                std::for_each(effectComponents.begin(), effectComponents.end(), [this](const auto& comp)
-                              {
-                    if (comp->get_changed())
-                    {
-                        amp_ops->set_effect(comp->getSettings());
-                    } });
-            }
+            std::for_each(effectComponents.begin(), effectComponents.end(), [&batch](const auto& comp)
+                          {
+                if (comp->get_changed())
+                {
+                    batch.set_effect(comp->getSettings());
+                } });
+        }
+
+        batch.set_amplifier(amp_settings);
+        run_on_amp([batch](com::Mustang& device)
+                   { device.commit(batch); },
+                   [] {});
+    }
 
-            amp_ops->set_amplifier(amp_settings);
+    // stream dial changes while they happen, if enabled
+    void MainWindow::set_effect_live(fx_pedal_settings pedal)
+    {
+        QSettings settings;
+
+        if (connected && liveUpdater && settings.value("Settings/liveMode").toBool())
+        {
+            liveUpdater->update(pedal);
         }
-        catch (const std::exception& ex)
+    }
+
+    void MainWindow::set_amplifier_live(amp_settings amp_settings)
+    {
+        QSettings settings;
+
+        if (connected && liveUpdater && settings.value("Settings/liveMode").toBool())
         {
-            qWarning() << "ERROR: " << ex.what();
-            ui->statusBar->showMessage(QString(tr("Error: %1")).arg(ex.what()), 5000);
-            return;
+            liveUpdater->update(amp_settings);
         }
     }
 
@@ -435,83 +634,230 @@ namespace plug
             return;
         }
 
-        try
-        {
-            amp_ops->save_on_amp(name, static_cast<std::uint8_t>(slot));
-        }
-        catch (const std::exception& ex)
+        run_on_amp([presetName = std::string{name}, slot](com::Mustang& device)
+                   { device.save_on_amp(presetName, static_cast<std::uint8_t>(slot)); },
+                   [this, presetName = QString{name}, slot]
+                   {
+                       if (presetName.isEmpty())
+                       {
+                           setWindowTitle(QString(tr("PLUG: NONE")));
+                           setAccessibleName(QString(tr("Main window: NONE")));
+                       }
+                       else
+                       {
+                           setWindowTitle(QString(tr("PLUG: %1")).arg(presetName));
+                           setAccessibleName(QString(tr("Main window: %1")).arg(presetName));
+                       }
+
+                       current_name = presetName;
+                       presetNames[static_cast<std::size_t>(slot)] = current_name.toStdString();
+                       update_preset_cache(presetNames);
+                   });
+    }
+
+    void MainWindow::load_from_amp(int slot)
+    {
+        if (!connected)
         {
-            qWarning() << "ERROR: " << ex.what();
-            ui->statusBar->showMessage(QString(tr("Error: %1")).arg(ex.what()), 5000);
+            if (const auto cached = presetCache ? presetCache->bank(static_cast<std::size_t>(slot)) : std::nullopt; cached)
+            {
+                show_signal_chain(*cached);
+            }
             return;
         }
 
-        if (name[0] == 0x00)
+        run_on_amp([slot](com::Mustang& device)
+                   { return device.load_memory_bank(static_cast<std::uint8_t>(slot)); },
+                   [this, slot](const SignalChain& signalChain)
+                   {
+                       show_signal_chain(signalChain);
+
+                       if (presetCache && presetCache->setBank(static_cast<std::size_t>(slot), signalChain))
+                       {
+                           com::savePresetCache(presetCacheDirectory(), *presetCache);
+                       }
+                   });
+    }
+
+    void MainWindow::add_preset_name(std::size_t index, const std::string& presetName)
+    {
+        presetNames.push_back(presetName);
+        load->add_name(index, presetName);
+        save->add_name(index, presetName);
+        ui->statusBar->showMessage(QString(tr("Connecting... %1 presets received")).arg(index + 1));
+    }
+
+    // like show_signal_chain(), with the connected amp in the title
+    void MainWindow::show_current_preset(const SignalChain& signalChain)
+    {
+        show_signal_chain(signalChain);
+
+        if (current_name.isEmpty() == false)
         {
-            setWindowTitle(QString(tr("PLUG: NONE")));
-            setAccessibleName(QString(tr("Main window: NONE")));
+            const auto model = amp_ops->getDeviceModel();
+            setWindowTitle(QString(tr("PLUG - %1 %2: %3"))
+                               .arg(QString::fromStdString(model.name()))
+                               .arg(model.category() == DeviceModel::Category::MustangV2 ? "(v2)" : "")
+                               .arg(current_name));
         }
-        else
+    }
+
+    void MainWindow::show_error(const QString& message)
+    {
+        qWarning() << "ERROR: " << message;
+        ui->statusBar->showMessage(QString(tr("Error: %1")).arg(message), 5000);
+
+        if (connected == false)
         {
-            setWindowTitle(QString(tr("PLUG: %1")).arg(name));
-            setAccessibleName(QString(tr("Main window: %1")).arg(name));
+            ui->actionConnect->setDisabled(false);
         }
+    }
 
-        current_name = name;
-        presetNames[static_cast<std::size_t>(slot)] = current_name.toStdString();
+    void MainWindow::start_live_updates()
+    {
+        QSettings settings;
+        const auto rate = settings.value("Settings/liveModeRate", 30).toUInt();
+
+        // the updater is released before the amp, see release()
+        liveUpdater = std::make_unique<com::LiveUpdater>([device = amp_ops.get()](const com::CommandBatch& batch)
+                                                         { device->commit(batch).get(); },
+                                                         rate,
+                                                         [this](const com::LiveStats& stats)
+                                                         {
+                                                             QMetaObject::invokeMethod(this, [this, stats]
+                                                                                       { show_live_stats(stats); }, Qt::QueuedConnection);
+                                                         });
     }
 
-    void MainWindow::load_from_amp(int slot)
+    void MainWindow::show_live_stats(const com::LiveStats& stats)
+    {
+        ui->statusBar->showMessage(QString(tr("Live: %1 updates/s, latency %2 ms (max %3 ms), %4 of %5 changes coalesced"))
+                                       .arg(stats.transfersPerSecond, 0, 'f', 1)
+                                       .arg(static_cast<double>(stats.averageLatency.count()) / 1000.0, 0, 'f', 1)
+                                       .arg(static_cast<double>(stats.maxLatency.count()) / 1000.0, 0, 'f', 1)
+                                       .arg(stats.coalesced)
+                                       .arg(stats.updates),
+                                   2000);
+    }
+
+    void MainWindow::show_amp_event(const com::AmpEvent& ampEvent)
     {
         if (!connected)
         {
             return;
         }
 
+        amp_ops->track(ampEvent);
+
+        if (const auto* ampChanged = std::get_if<com::event::AmpChanged>(&ampEvent))
+        {
+            amp->load(ampChanged->amp);
+        }
+        else if (const auto* effectChanged = std::get_if<com::event::EffectChanged>(&ampEvent))
+        {
+            effectComponents.at(effectChanged->effect.slot.id())->load(effectChanged->effect);
+        }
+        else if (const auto* presetSelected = std::get_if<com::event::PresetSelected>(&ampEvent))
+        {
+            show_signal_chain(presetSelected->signalChain);
+            ui->statusBar->showMessage(QString(tr("Preset %1 selected on the amp")).arg(presetSelected->slot), 3000);
+        }
+    }
+
+    void MainWindow::show_signal_chain(const SignalChain& signalChain)
+    {
         QSettings settings;
-        try
+        const QString bankName = QString::fromStdString(signalChain.name());
+
+        if (bankName.isEmpty())
         {
-            const auto signalChain = amp_ops->load_memory_bank(static_cast<std::uint8_t>(slot));
-            const QString bankName = QString::fromStdString(signalChain.name());
+            setWindowTitle(QString(tr("PLUG: NONE")));
+            setAccessibleName(QString(tr("Main window: NONE")));
+        }
+        else
+        {
+            setWindowTitle(QString(tr("PLUG: %1")).arg(bankName));
+            setAccessibleName(QString(tr("Main window: %1")).arg(bankName));
+        }
 
+        current_name = bankName;
 
-            if (bankName.isEmpty())
-            {
-                setWindowTitle(QString(tr("PLUG: NONE")));
-                setAccessibleName(QString(tr("Main window: NONE")));
-            }
-            else
-            {
-                setWindowTitle(QString(tr("PLUG: %1")).arg(bankName));
-                setAccessibleName(QString(tr("Main window: %1")).arg(bankName));
-            }
+        amp->load(signalChain.amp());
+        if (settings.value("Settings/popupChangedWindows").toBool())
+        {
+            amp->show();
+        }
 
-            current_name = bankName;
+        const auto effects_set = signalChain.effects();
+        const bool shouldPopup = settings.value("Settings/popupChangedWindows").toBool();
+        std::for_each(effects_set.cbegin(), effects_set.cend(), [this, shouldPopup](const auto& effect)
+                      {
+            const auto component = effectComponents.at(effect.slot.id());
 
-            amp->load(signalChain.amp());
-            if (settings.value("Settings/popupChangedWindows").toBool())
+            component->load(effect);
+            if ((effect.effect_num != effects::EMPTY) && shouldPopup)
             {
-                amp->show();
-            }
+                component->show();
+            } });
+    }
 
-            const auto effects_set = signalChain.effects();
-            const bool shouldPopup = settings.value("Settings/popupChangedWindows").toBool();
-            std::for_each(effects_set.cbegin(), effects_set.cend(), [this, shouldPopup](const auto& effect)
-                          {
-                const auto component = effectComponents.at(effect.slot.id());
+    void MainWindow::restore_preset_cache()
+    {
+        QSettings settings;
 
-                component->load(effect);
-                if ((effect.effect_num != effects::EMPTY) && shouldPopup)
-                {
-                    component->show();
-                } });
+        if (!settings.contains("PresetCache/productId"))
+        {
+            return;
         }
-        catch (const std::exception& ex)
+
+        const com::DeviceIdentity identity{static_cast<std::uint16_t>(settings.value("PresetCache/vendorId").toUInt()),
+                                           static_cast<std::uint16_t>(settings.value("PresetCache/productId").toUInt()),
+                                           settings.value("PresetCache/name").toString().toStdString(),
+                                           {}};
+        presetCache = com::loadPresetCache(presetCacheDirectory(), identity);
+        show_cached_presets();
+    }
+
+    void MainWindow::show_cached_presets()
+    {
+        if (!presetCache || presetCache->presetNames().empty())
+        {
+            return;
+        }
+
+        presetNames = presetCache->presetNames();
+        load->delete_items();
+        load->load_names(presetNames);
+        quickpres->delete_items();
+        quickpres->load_names(presetNames);
+        ui->action_Load_from_amplifier->setDisabled(false);
+        ui->action_Library_view->setDisabled(false);
+    }
+
+    // keep the cache of the connected device in line with the names streamed from it
+    void MainWindow::update_preset_cache(const std::vector<std::string>& names)
+    {
+        if (amp_ops == nullptr)
         {
-            qWarning() << "ERROR: " << ex.what();
-            ui->statusBar->showMessage(QString(tr("Error: %1")).arg(ex.what()), 5000);
             return;
         }
+
+        const auto identity = amp_ops->getDeviceIdentity();
+
+        if (!presetCache || !(presetCache->device() == identity))
+        {
+            presetCache = com::loadPresetCache(presetCacheDirectory(), identity).value_or(com::PresetCache{identity});
+
+            QSettings settings;
+            settings.setValue("PresetCache/vendorId", identity.vendorId);
+            settings.setValue("PresetCache/productId", identity.productId);
+            settings.setValue("PresetCache/name", QString::fromStdString(identity.name));
+        }
+
+        if (presetCache->setPresetNames(names))
+        {
+            com::savePresetCache(presetCacheDirectory(), *presetCache);
+        }
     }
 
     // activate buttons
@@ -573,16 +919,9 @@ namespace plug
             set_effect(effects[1]);
         }
 
-        try
-        {
-            amp_ops->save_effects(static_cast<std::uint8_t>(slot), name, effects);
-        }
-        catch (const std::exception& ex)
-        {
-            qWarning() << "ERROR: " << ex.what();
-            ui->statusBar->showMessage(QString(tr("Error: %1")).arg(ex.what()), 5000);
-            return;
-        }
+        run_on_amp([slot, effectName = std::string{name}, effects](com::Mustang& device)
+                   { device.save_effects(static_cast<std::uint8_t>(slot), effectName, effects); },
+                   [] {});
     }
 
     void MainWindow::loadfile(QString filename)
@@ -623,10 +962,6 @@ namespace plug
         change_title(fileSettings.name);
 
         amp->load(fileSettings.amp);
-        if (connected)
-        {
-            amp->send_amp();
-        }
 
         const bool shouldPopup = settings.value("Settings/popupChangedWindows").toBool();
 
@@ -640,15 +975,31 @@ namespace plug
             const auto& component = effectComponents.at(effect.slot.id());
             component->load(effect);
 
-            if (connected)
-            {
-                component->send_fx();
-            }
-
             if ((effect.effect_num != effects::EMPTY) && shouldPopup)
             {
                 component->show();
             } });
+
+        if (connected)
+        {
+            send_loaded_settings(fileSettings.effects);
+        }
+    }
+
+    // write the populated settings once, instead of echoing every widget change
+    void MainWindow::send_loaded_settings(const std::vector<fx_pedal_settings>& loadedEffects)
+    {
+        com::CommandBatch batch;
+        amp_settings amplifier_settings{};
+        amp->get_settings(&amplifier_settings);
+        batch.set_amplifier(amplifier_settings);
+
+        std::for_each(loadedEffects.cbegin(), loadedEffects.cend(), [this, &batch](const auto& effect)
+                      { batch.set_effect(effectComponents.at(effect.slot.id())->getSettings()); });
+
+        run_on_amp([batch](com::Mustang& device)
+                   { device.commit(batch); },
+                   [] {});
     }
 
     void MainWindow::get_settings(amp_settings* amplifier_settings, std::vector<fx_pedal_settings>& fx_settings)
@@ -721,15 +1072,29 @@ namespace plug
 
     void MainWindow::update_firmware()
     {
-        QString filename;
-        QMessageBox::information(this, "Prepare", R"(Please power off the amplifier, then power it back on while holding down:<ul><li>The "Save" button (Mustang I and II)</li><li>The Data Wheel (Mustang III, IV and IV)</li></ul>After pressing "OK" choose firmware file and then update will begin.It will take about one minute. You will be notified when it's finished.)");
-
-        filename = QFileDialog::getOpenFileName(this, tr("Open..."), QDir::homePath(), tr("Mustang firmware (*.upd)"));
+        const QString filename = QFileDialog::getOpenFileName(this, tr("Open..."), QDir::homePath(), tr("Mustang firmware (*.upd)"));
         if (filename.isEmpty())
         {
             return;
         }
 
+        // Check the image before the amp is put into update mode
+        std::optional<com::FirmwareImage> image;
+        try
+        {
+            image.emplace(com::loadFirmwareImage(filename.toStdString()));
+        }
+        catch (const std::exception& ex)
+        {
+            show_error(QString(tr("Invalid firmware file: %1")).arg(ex.what()));
+            return;
+        }
+
+        const auto seconds = std::chrono::ceil<std::chrono::seconds>(image->estimateDuration()).count();
+        QMessageBox::information(this, "Prepare", QString(tr(R"(Firmware built %1.<br>Please power off the amplifier, then power it back on while holding down:<ul><li>The "Save" button (Mustang I and II)</li><li>The Data Wheel (Mustang III, IV and IV)</li></ul>After pressing "OK" the update will begin. It will take about %2 seconds. You will be notified when it's finished.)"))
+                                                      .arg(QString::fromStdString(image->date()))
+                                                      .arg(seconds));
+
         if (connected)
         {
             this->stop_amp();
@@ -738,19 +1103,44 @@ namespace plug
         ui->statusBar->showMessage("Updating firmware. Please wait...");
         ui->centralWidget->setDisabled(true);
         ui->menuBar->setDisabled(true);
-        this->repaint();
-        const int ret = com::updateFirmware(filename.toLatin1().constData());
+
+        firmwareUpdate = std::async(std::launch::async, [this, firmware = std::move(*image)]
+                                    {
+            const int ret = com::updateFirmware(firmware, [this](const com::UpdateProgress& progress)
+                                                {
+                                                    QMetaObject::invokeMethod(this, [this, progress]
+                                                                              { show_update_progress(progress); }, Qt::QueuedConnection);
+                                                });
+            QMetaObject::invokeMethod(this, [this, ret]
+                                      { firmware_updated(ret); }, Qt::QueuedConnection); });
+    }
+
+    void MainWindow::show_update_progress(const com::UpdateProgress& progress)
+    {
+        ui->statusBar->showMessage(QString(tr("Updating firmware: %1 of %2 packets (%3 kB/s)"))
+                                       .arg(progress.packetsSent)
+                                       .arg(progress.packetsTotal)
+                                       .arg(progress.bytesPerSecond / 1000.0, 0, 'f', 1));
+    }
+
+    void MainWindow::firmware_updated(int result)
+    {
         ui->centralWidget->setDisabled(false);
         ui->menuBar->setDisabled(false);
         ui->statusBar->showMessage("", 1);
-        if (ret == -100)
+        if (result == com::updateErrorNoDevice)
         {
             ui->statusBar->showMessage(tr("Error: Suitable device not found!"), 5000);
             return;
         }
-        if (ret != 0)
+        if (result == com::updateErrorFile)
         {
-            ui->statusBar->showMessage(QString(tr("Communication error: %1")).arg(ret), 5000);
+            ui->statusBar->showMessage(tr("Error: Can't read firmware file!"), 5000);
+            return;
+        }
+        if (result != 0)
+        {
+            ui->statusBar->showMessage(QString(tr("Communication error: %1")).arg(result), 5000);
             return;
         }
         QMessageBox::information(this, "Update finished", R"(<b>Update finished</b><br>If "Exit" button is lit - update was succesful<br>If "Save" button is lit - update failed<br><br>Power off the amplifier and then back on to finish the process.)");
@@ -764,7 +1154,7 @@ namespace plug
 
     void MainWindow::empty_other(int value, Effect* caller)
     {
-        const int fx_family = check_fx_family(static_cast<effects>(value));
+        const auto fx_family = effectModel(static_cast<effects>(value)).family;
         fx_pedal_settings settings{FxSlot{0}, effects::EMPTY, 0, 0, 0, 0, 0, 0, false};
 
         std::for_each(effectComponents.cbegin(), effectComponents.cend(), [&caller, &settings, fx_family](const auto& comp)
@@ -773,10 +1163,17 @@ namespace plug
             {
                 settings = comp->getSettings();
 
-                if (check_fx_family(settings.effect_num) == fx_family)
+                if (effectModel(settings.effect_num).family == fx_family)
                 {
-                    comp->choose_fx(0);
-                    comp->send_fx();
+                    if (caller->is_populating())
+                    {
+                        comp->load(fx_pedal_settings{settings.slot, effects::EMPTY, 0, 0, 0, 0, 0, 0, false});
+                    }
+                    else
+                    {
+                        comp->choose_fx(0);
+                        comp->send_fx();
+                    }
                 }
             } });
     }
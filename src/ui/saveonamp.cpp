@@ -63,19 +63,19 @@ namespace plug
 
     void SaveOnAmp::load_names(const std::vector<std::string>& names)
     {
-        std::size_t index{1};
+        std::size_t index{0};
         std::for_each(names.cbegin(), names.cend(), [&index, this](const auto& name)
-                      {
-            ui->comboBox->addItem(QString("[%1] %2").arg(index).arg(QString::fromStdString(name)));
-            ++index; });
+                      { add_name(index++, name); });
+    }
+
+    void SaveOnAmp::add_name(std::size_t index, const std::string& name)
+    {
+        ui->comboBox->addItem(QString("[%1] %2").arg(index + 1).arg(QString::fromStdString(name)));
     }
 
     void SaveOnAmp::delete_items()
     {
-        for (int i = 0; i < ui->comboBox->count(); ++i)
-        {
-            ui->comboBox->removeItem(0);
-        }
+        ui->comboBox->clear();
     }
 
     void SaveOnAmp::change_index(int value, const QString& name)
@@ -21,6 +21,7 @@
 
 #include "ui/savetofile.h"
 #include "ui/mainwindow.h"
+#include "com/IdLookup.h"
 #include "ui_savetofile.h"
 #include <QFileDialog>
 #include <QMessageBox>
@@ -97,116 +98,11 @@ namespace plug
 
     void SaveToFile::writeAmp(amp_settings settings)
     {
-        int model{0};
-        int something{0};
-        int something2{0};
-        int something3{128};
-
-        switch (static_cast<amps>(settings.amp_num))
-        {
-            case amps::FENDER_57_DELUXE:
-                model = 0x67;
-                something = 0x01;
-                something2 = 0x53;
-                break;
-
-            case amps::FENDER_59_BASSMAN:
-                model = 0x64;
-                something = 0x02;
-                something2 = 0x67;
-                break;
-
-            case amps::FENDER_57_CHAMP:
-                model = 0x7c;
-                something = 0x0c;
-                something2 = 0x00;
-                break;
-
-            case amps::FENDER_65_DELUXE_REVERB:
-                model = 0x53;
-                something = 0x03;
-                something2 = 0x6a;
-                something3 = 0x00;
-                break;
-
-            case amps::FENDER_65_PRINCETON:
-                model = 0x6a;
-                something = 0x04;
-                something2 = 0x61;
-                break;
-
-            case amps::FENDER_65_TWIN_REVERB:
-                model = 0x75;
-                something = 0x05;
-                something2 = 0x72;
-                break;
-
-            case amps::FENDER_SUPER_SONIC:
-                model = 0x72;
-                something = 0x06;
-                something2 = 0x79;
-                break;
-
-            case amps::BRITISH_60S:
-                model = 0x61;
-                something = 0x07;
-                something2 = 0x5e;
-                break;
-
-            case amps::BRITISH_70S:
-                model = 0x79;
-                something = 0x0b;
-                something2 = 0x7c;
-                break;
-
-            case amps::BRITISH_80S:
-                model = 0x5e;
-                something = 0x09;
-                something2 = 0x5d;
-                break;
-
-            case amps::AMERICAN_90S:
-                model = 0x5d;
-                something = 0x0a;
-                something2 = 0x6d;
-                break;
-
-            case amps::METAL_2000:
-                model = 0x6d;
-                something = 0x08;
-                something2 = 0x75;
-                break;
-
-            case amps::STUDIO_PREAMP:
-                model = 0xf1;
-                something = 0x0d;
-                something2 = 0xf6;
-                break;
-
-            case amps::FENDER_57_TWIN:
-                model = 0xf6;
-                something = 0x0e;
-                something2 = 0xf9;
-                break;
-
-            case amps::FENDER_60_THRIFT:
-                model = 0xf9;
-                something = 0x0f;
-                something2 = 0xfc;
-                break;
-
-            case amps::BRITISH_COLOUR:
-                model = 0xfc;
-                something = 0x10;
-                something2 = 0xff;
-                break;
-
-            case amps::BRITISH_WATTS:
-                model = 0xff;
-                something = 0x11;
-                something2 = 0x00;
-                break;
-        }
+        const auto& amp = ampModel(settings.amp_num);
+        const int model{amp.id};
+        const int something{amp.ampSpecific};
+        const int something2{amp.ampSpecificLast};
+        const int something3{amp.unknown};
 
         xml->writeStartElement("Amplifier");
         xml->writeStartElement("Module");
@@ -336,210 +232,51 @@ namespace plug
     void SaveToFile::manageWriteFX(const std::vector<fx_pedal_settings>& settings)
     {
         constexpr fx_pedal_settings empty{FxSlot{0}, effects::EMPTY, 0, 0, 0, 0, 0, 0, false};
-        auto writeOrEmpty = [&settings, empty, this](const auto& itr)
-        { writeFX(itr != settings.cend() ? *itr : empty); };
+        auto writeFamily = [&settings, empty, this](EffectFamily family)
+        {
+            const auto itr = std::find_if(settings.cbegin(), settings.cend(), [family](const auto& effect)
+                                          { return effectModel(effect.effect_num).family == family; });
+            writeFX(itr != settings.cend() ? *itr : empty);
+        };
         xml->writeStartElement("FX");
 
 
         xml->writeStartElement("Stompbox");
         xml->writeAttribute("ID", "1");
 
-        auto stomp = std::find_if(settings.cbegin(), settings.cend(), [](const auto& effect)
-                                  { return (effect.effect_num > effects::EMPTY) && (effect.effect_num <= effects::COMPRESSOR); });
-        writeOrEmpty(stomp);
+        writeFamily(EffectFamily::stomp);
         xml->writeEndElement(); // end Stompbox
 
 
         xml->writeStartElement("Modulation");
         xml->writeAttribute("ID", "2");
-        auto modulation = std::find_if(settings.cbegin(), settings.cend(), [](const auto& effect)
-                                       { return (effect.effect_num >= effects::SINE_CHORUS) && (effect.effect_num <= effects::PITCH_SHIFTER); });
-        writeOrEmpty(modulation);
+        writeFamily(EffectFamily::modulation);
         xml->writeEndElement(); // end Modulation
 
 
         xml->writeStartElement("Delay");
         xml->writeAttribute("ID", "3");
-        auto delay = std::find_if(settings.cbegin(), settings.cend(), [](const auto& effect)
-                                  { return (effect.effect_num >= effects::MONO_DELAY) && (effect.effect_num <= effects::STEREO_TAPE_DELAY); });
-        writeOrEmpty(delay);
+        writeFamily(EffectFamily::delay);
         xml->writeEndElement(); // end Delay
 
 
         xml->writeStartElement("Reverb");
         xml->writeAttribute("ID", "4");
-        auto reverb = std::find_if(settings.cbegin(), settings.cend(), [](const auto& effect)
-                                   { return (effect.effect_num >= effects::SMALL_HALL_REVERB) && (effect.effect_num <= effects::FENDER_65_SPRING_REVERB); });
-        writeOrEmpty(reverb);
+        writeFamily(EffectFamily::reverb);
         xml->writeEndElement(); // end Reverb
         xml->writeEndElement(); // end FX
     }
 
     void SaveToFile::writeFX(fx_pedal_settings settings)
     {
-        int model{0};
-
-        switch (static_cast<effects>(settings.effect_num))
-        {
-            case effects::EMPTY:
-                model = 0x00;
-                break;
-
-            case effects::OVERDRIVE:
-                model = 0x3c;
-                break;
-
-            case effects::WAH:
-                model = 0x49;
-                break;
-
-            case effects::TOUCH_WAH:
-                model = 0x4a;
-                break;
-
-            case effects::FUZZ:
-                model = 0x1a;
-                break;
-
-            case effects::FUZZ_TOUCH_WAH:
-                model = 0x1c;
-                break;
-
-            case effects::SIMPLE_COMP:
-                model = 0x88;
-                break;
-
-            case effects::COMPRESSOR:
-                model = 0x07;
-                break;
-
-            case effects::SINE_CHORUS:
-                model = 0x12;
-                break;
-
-            case effects::TRIANGLE_CHORUS:
-                model = 0x13;
-                break;
-
-            case effects::SINE_FLANGER:
-                model = 0x18;
-                break;
-
-            case effects::TRIANGLE_FLANGER:
-                model = 0x19;
-                break;
-
-            case effects::VIBRATONE:
-                model = 0x2d;
-                break;
-
-            case effects::VINTAGE_TREMOLO:
-                model = 0x40;
-                break;
-
-            case effects::SINE_TREMOLO:
-                model = 0x41;
-                break;
-
-            case effects::RING_MODULATOR:
-                model = 0x22;
-                break;
-
-            case effects::STEP_FILTER:
-                model = 0x29;
-                break;
-
-            case effects::PHASER:
-                model = 0x4f;
-                break;
-
-            case effects::PITCH_SHIFTER:
-                model = 0x1f;
-                break;
-
-            case effects::MONO_DELAY:
-                model = 0x16;
-                break;
-
-            case effects::MONO_ECHO_FILTER:
-                model = 0x43;
-                break;
-
-            case effects::STEREO_ECHO_FILTER:
-                model = 0x48;
-                break;
-
-            case effects::MULTITAP_DELAY:
-                model = 0x44;
-                break;
-
-            case effects::PING_PONG_DELAY:
-                model = 0x45;
-                break;
-
-            case effects::DUCKING_DELAY:
-                model = 0x15;
-                break;
-
-            case effects::REVERSE_DELAY:
-                model = 0x46;
-                break;
-
-            case effects::TAPE_DELAY:
-                model = 0x2b;
-                break;
-
-            case effects::STEREO_TAPE_DELAY:
-                model = 0x2a;
-                break;
-
-            case effects::SMALL_HALL_REVERB:
-                model = 0x24;
-                break;
-
-            case effects::LARGE_HALL_REVERB:
-                model = 0x3a;
-                break;
-
-            case effects::SMALL_ROOM_REVERB:
-                model = 0x26;
-                break;
-
-            case effects::LARGE_ROOM_REVERB:
-                model = 0x3b;
-                break;
-
-            case effects::SMALL_PLATE_REVERB:
-                model = 0x4e;
-                break;
-
-            case effects::LARGE_PLATE_REVERB:
-                model = 0x4b;
-                break;
-
-            case effects::AMBIENT_REVERB:
-                model = 0x4c;
-                break;
-
-            case effects::ARENA_REVERB:
-                model = 0x4d;
-                break;
-
-            case effects::FENDER_63_SPRING_REVERB:
-                model = 0x21;
-                break;
-
-            case effects::FENDER_65_SPRING_REVERB:
-                model = 0x0b;
-                break;
-        }
+        const int model{effectModel(settings.effect_num).id};
 
         xml->writeStartElement("Module");
         xml->writeAttribute("ID", QString("%1").arg(model));
         xml->writeAttribute("POS", QString("%1").arg(settings.slot.id()));
         xml->writeAttribute("BypassState", "1");
 
-        if (model == value(effects::EMPTY))
+        if (settings.effect_num == effects::EMPTY)
         {
             xml->writeCharacters("");
             xml->writeEndElement(); // end Module
@@ -577,10 +314,7 @@ namespace plug
         xml->writeCharacters(QString("%1").arg((settings.knob5 << 8) | settings.knob5));
         xml->writeEndElement();
 
-        if ((settings.effect_num != effects::MONO_ECHO_FILTER) &&
-            (settings.effect_num != effects::STEREO_ECHO_FILTER) &&
-            (settings.effect_num != effects::TAPE_DELAY) &&
-            (settings.effect_num != effects::STEREO_TAPE_DELAY))
+        if (effectModel(settings.effect_num).knobs[5].max == 0)
         {
             xml->writeEndElement(); // end Module
             return;
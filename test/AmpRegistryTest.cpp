@@ -0,0 +1,89 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "com/AmpRegistry.h"
+#include "mocks/MockConnection.h"
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <gmock/gmock.h>
+
+namespace plug::test
+{
+    using namespace plug::com;
+    using namespace testing;
+    using namespace std::chrono_literals;
+
+    class AmpRegistryTest : public testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            std::vector<std::unique_ptr<Mustang>> devices;
+            devices.push_back(std::make_unique<Mustang>(DeviceModel{"Device A", DeviceModel::Category::MustangV1, 24},
+                                                        std::make_shared<NiceMock<mock::MockConnection>>(),
+                                                        DeviceIdentity{0x1ed8, 0x0004, "A", "1-1"}));
+            devices.push_back(std::make_unique<Mustang>(DeviceModel{"Device B", DeviceModel::Category::MustangV2, 100},
+                                                        std::make_shared<NiceMock<mock::MockConnection>>(),
+                                                        DeviceIdentity{0x1ed8, 0x0014, "B", "1-2"}));
+            registry = std::make_unique<AmpRegistry>(std::move(devices));
+        }
+
+        std::unique_ptr<AmpRegistry> registry;
+    };
+
+
+    TEST_F(AmpRegistryTest, ampsAreAddressedByIndex)
+    {
+        EXPECT_THAT(registry->size(), Eq(2));
+        EXPECT_THAT(registry->empty(), IsFalse());
+        EXPECT_THAT(registry->at(0).getDeviceModel().name(), StrEq("Device A"));
+        EXPECT_THAT(registry->at(1).getDeviceModel().name(), StrEq("Device B"));
+        EXPECT_THROW(registry->at(2), std::out_of_range);
+    }
+
+    TEST_F(AmpRegistryTest, identitiesAreInOrderOfAmps)
+    {
+        const auto identities = registry->identities();
+        ASSERT_THAT(identities.size(), Eq(2));
+        EXPECT_THAT(identities[0].name, StrEq("A"));
+        EXPECT_THAT(identities[1].productId, Eq(0x0014));
+    }
+
+    TEST_F(AmpRegistryTest, runAllRunsOnEveryAmpInParallel)
+    {
+        std::mutex mutex;
+        std::condition_variable arrived;
+        std::size_t running{0};
+
+        // Only returns true if the other amp runs the command at the same time
+        auto results = registry->runAll([&](Mustang& device)
+                                        {
+            std::unique_lock lock{mutex};
+            ++running;
+            arrived.notify_all();
+            const bool parallel = arrived.wait_for(lock, 2s, [&running] { return running == 2; });
+            return std::make_pair(device.getDeviceIdentity().name, parallel); });
+
+        ASSERT_THAT(results.size(), Eq(2));
+        EXPECT_THAT(results[0].get(), Pair(StrEq("A"), IsTrue()));
+        EXPECT_THAT(results[1].get(), Pair(StrEq("B"), IsTrue()));
+    }
+}
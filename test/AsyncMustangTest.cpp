@@ -0,0 +1,97 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "com/AsyncMustang.h"
+#include "com/CommunicationException.h"
+#include "com/PacketSerializer.h"
+#include "mocks/MockConnection.h"
+#include "matcher/Matcher.h"
+#include "matcher/TypeMatcher.h"
+#include <gmock/gmock.h>
+
+namespace plug::test
+{
+    using namespace plug::test::matcher;
+    using namespace plug::com;
+    using namespace testing;
+
+    class AsyncMustangTest : public testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            conn = std::make_shared<NiceMock<mock::MockConnection>>();
+            m = std::make_unique<AsyncMustang>(std::make_unique<Mustang>(DeviceModel{"Test Device", DeviceModel::Category::MustangV1, 100}, conn));
+        }
+
+        std::shared_ptr<NiceMock<mock::MockConnection>> conn;
+        std::unique_ptr<AsyncMustang> m;
+        const std::vector<std::uint8_t> ignoreData = std::vector<std::uint8_t>(packetRawTypeSize);
+    };
+
+
+    TEST_F(AsyncMustangTest, setAmplifierSendsOnWorkerThread)
+    {
+        constexpr amp_settings settings{amps::BRITISH_70S, 8, 9, 1, 2, 3,
+                                        cabinets::cab4x12G, 3, 5, 3, 2, 1,
+                                        4, 1, 5, true, 4};
+        const auto data = serializeAmpSettings(settings).getBytes();
+        const auto caller = std::this_thread::get_id();
+        std::thread::id sender{};
+
+        EXPECT_CALL(*conn, sendImpl(BufferIs(data), data.size())).WillOnce(DoAll([&sender]
+                                                                                 { sender = std::this_thread::get_id(); },
+                                                                                 Return(data.size())));
+        EXPECT_CALL(*conn, sendImpl(Not(BufferIs(data)), _)).WillRepeatedly(Return(packetRawTypeSize));
+        ON_CALL(*conn, receive(_)).WillByDefault(Return(ignoreData));
+
+        m->set_amplifier(settings).get();
+        EXPECT_THAT(sender, Ne(caller));
+    }
+
+    TEST_F(AsyncMustangTest, loadMemoryBankReturnsSignalChain)
+    {
+        std::vector<std::uint8_t> ampData(packetRawTypeSize, 0x00);
+        ampData[0] = 0x1c;
+        ampData[1] = 0x01;
+        ampData[2] = 0x05;
+        ampData[16] = 0x5e;
+        std::vector<std::uint8_t> confirmation(packetRawTypeSize, 0x00);
+        confirmation[0] = 0x1c;
+        confirmation[1] = 0x01;
+
+        EXPECT_CALL(*conn, sendImpl(_, _)).WillOnce(Return(packetRawTypeSize));
+        EXPECT_CALL(*conn, receive(packetRawTypeSize)).WillOnce(Return(ampData)).WillOnce(Return(confirmation));
+
+        const auto signalChain = m->load_memory_bank(3).get();
+        EXPECT_THAT(signalChain.amp().amp_num, Eq(amps::BRITISH_80S));
+    }
+
+    TEST_F(AsyncMustangTest, exceptionIsPassedToFuture)
+    {
+        EXPECT_CALL(*conn, isOpen()).WillOnce(Return(false));
+        auto result = m->start_amp(StartObserver{});
+        EXPECT_THROW(result.get(), CommunicationException);
+    }
+
+    TEST_F(AsyncMustangTest, deviceInfoIsAvailableWithoutWorker)
+    {
+        EXPECT_THAT(m->getDeviceModel().name(), StrEq("Test Device"));
+    }
+}
@@ -0,0 +1,111 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "com/Broadcast.h"
+#include "com/CommandBatch.h"
+#include "com/CommunicationException.h"
+#include "com/PacketSerializer.h"
+#include "mocks/MockConnection.h"
+#include <mutex>
+#include <gmock/gmock.h>
+
+namespace plug::test
+{
+    using namespace plug::com;
+    using namespace testing;
+
+    class BroadcastTest : public testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            std::vector<std::unique_ptr<Mustang>> devices;
+
+            for (std::size_t i = 0; i < connections.size(); ++i)
+            {
+                connections[i] = std::make_shared<NiceMock<mock::MockConnection>>();
+                ON_CALL(*connections[i], sendImpl(_, _)).WillByDefault([this, i](const std::uint8_t* data, std::size_t size)
+                                                                       {
+                    std::lock_guard lock{mutex};
+                    sent[i].emplace_back(data, std::next(data, static_cast<std::ptrdiff_t>(size)));
+                    return size; });
+                ON_CALL(*connections[i], receive(_)).WillByDefault(Return(ignoreData));
+                devices.push_back(std::make_unique<Mustang>(DeviceModel{"Test Device", DeviceModel::Category::MustangV1, 100}, connections[i]));
+            }
+            registry = std::make_unique<AmpRegistry>(std::move(devices));
+        }
+
+        static constexpr amp_settings amp{amps::BRITISH_70S, 8, 9, 1, 2, 3,
+                                          cabinets::cab4x12G, 3, 5, 3, 2, 1,
+                                          4, 1, 5, true, 4};
+        static constexpr fx_pedal_settings effect{FxSlot{3}, effects::MONO_DELAY, 8, 7, 6, 5, 4, 3};
+
+        std::array<std::shared_ptr<NiceMock<mock::MockConnection>>, 2> connections;
+        std::unique_ptr<AmpRegistry> registry;
+        std::mutex mutex;
+        std::array<std::vector<std::vector<std::uint8_t>>, 2> sent;
+        const std::vector<std::uint8_t> ignoreData = std::vector<std::uint8_t>(packetRawTypeSize);
+    };
+
+
+    TEST_F(BroadcastTest, sendsSamePacketsToEveryAmp)
+    {
+        const SignalChain chain{"abc", amp, {effect}};
+        CommandBatch expected;
+        expected.set_signal_chain(chain);
+        std::vector<std::vector<std::uint8_t>> expectedPackets;
+        std::transform(expected.packets().cbegin(), expected.packets().cend(), std::back_inserter(expectedPackets), [](const auto& p)
+                       { return std::vector<std::uint8_t>(p.cbegin(), p.cend()); });
+        const auto applyCmd = serializeApplyCommand().getBytes();
+        expectedPackets.emplace_back(applyCmd.cbegin(), applyCmd.cend());
+
+        const auto stats = broadcast(*registry, chain);
+
+        EXPECT_THAT(stats.packets, Eq(expectedPackets.size()));
+        EXPECT_THAT(sent[0], ElementsAreArray(expectedPackets));
+        EXPECT_THAT(sent[1], ElementsAreArray(expectedPackets));
+    }
+
+    TEST_F(BroadcastTest, reportsLatencyPerAmpAndSpread)
+    {
+        const auto stats = broadcast(*registry, SignalChain{"abc", amp, {effect}});
+
+        ASSERT_THAT(stats.amps.size(), Eq(2));
+        EXPECT_THAT(stats.amps[0].error, Eq(std::nullopt));
+        EXPECT_THAT(stats.amps[1].error, Eq(std::nullopt));
+        EXPECT_THAT(stats.fastest, Le(stats.slowest));
+        EXPECT_THAT(stats.fastest, Eq(std::min(stats.amps[0].latency, stats.amps[1].latency)));
+        EXPECT_THAT(stats.slowest, Eq(std::max(stats.amps[0].latency, stats.amps[1].latency)));
+        EXPECT_THAT(stats.spread, Eq(stats.slowest - stats.fastest));
+    }
+
+    TEST_F(BroadcastTest, failingAmpDoesNotAffectOthers)
+    {
+        EXPECT_CALL(*connections[1], sendImpl(_, _)).WillRepeatedly(Throw(CommunicationException{"expected"}));
+
+        const auto stats = broadcast(*registry, SignalChain{"abc", amp, {effect}});
+
+        ASSERT_THAT(stats.amps.size(), Eq(2));
+        EXPECT_THAT(stats.amps[0].error, Eq(std::nullopt));
+        EXPECT_THAT(stats.amps[1].error, Optional(StrEq("expected")));
+        EXPECT_THAT(sent[0].size(), Eq(stats.packets));
+        EXPECT_THAT(stats.spread, Eq(std::chrono::microseconds{0}));
+    }
+}
@@ -0,0 +1,131 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "com/CommandBatch.h"
+#include "com/PacketSerializer.h"
+#include "matcher/TypeMatcher.h"
+#include <gmock/gmock.h>
+
+namespace plug::test
+{
+    using namespace plug::test::matcher;
+    using namespace plug::com;
+    using namespace testing;
+
+    class CommandBatchTest : public testing::Test
+    {
+    protected:
+        static constexpr amp_settings amp{amps::BRITISH_70S, 8, 9, 1, 2, 3,
+                                          cabinets::cab4x12G, 3, 5, 3, 2, 1,
+                                          4, 1, 5, true, 4};
+    };
+
+
+    TEST_F(CommandBatchTest, defaultIsEmpty)
+    {
+        const CommandBatch batch;
+        EXPECT_THAT(batch.empty(), IsTrue());
+        EXPECT_THAT(batch.size(), Eq(0));
+    }
+
+    TEST_F(CommandBatchTest, setAmplifierQueuesAmpAndUsbGain)
+    {
+        CommandBatch batch;
+        batch.set_amplifier(amp);
+
+        EXPECT_THAT(batch.packets(), ElementsAre(serializeAmpSettings(amp).getBytes(),
+                                                 serializeAmpSettingsUsbGain(amp).getBytes()));
+    }
+
+    TEST_F(CommandBatchTest, setEffectQueuesClearAndValue)
+    {
+        constexpr fx_pedal_settings effect{FxSlot{3}, effects::OVERDRIVE, 8, 7, 6, 5, 4, 3};
+        CommandBatch batch;
+        batch.set_effect(effect);
+
+        EXPECT_THAT(batch.packets(), ElementsAre(serializeClearEffectSettings(effect).getBytes(),
+                                                 serializeEffectSettings(effect).getBytes()));
+    }
+
+    TEST_F(CommandBatchTest, setEffectQueuesOnlyClearIfDisabled)
+    {
+        constexpr fx_pedal_settings effect{FxSlot{3}, effects::OVERDRIVE, 8, 7, 6, 5, 4, 3, false};
+        CommandBatch batch;
+        batch.set_effect(effect);
+
+        EXPECT_THAT(batch.packets(), ElementsAre(serializeClearEffectSettings(effect).getBytes()));
+    }
+
+    TEST_F(CommandBatchTest, setEffectQueuesOnlyClearIfEmptyEffect)
+    {
+        constexpr fx_pedal_settings effect{FxSlot{2}, effects::EMPTY, 0, 0, 0, 0, 0, 0};
+        CommandBatch batch;
+        batch.set_effect(effect);
+
+        EXPECT_THAT(batch.packets(), ElementsAre(serializeClearEffectSettings(effect).getBytes()));
+    }
+
+    TEST_F(CommandBatchTest, writesAreQueuedInOrder)
+    {
+        constexpr fx_pedal_settings effect{FxSlot{1}, effects::SINE_CHORUS, 1, 2, 3, 4, 5, 6};
+        CommandBatch batch;
+        batch.set_effect(effect);
+        batch.set_amplifier(amp);
+
+        EXPECT_THAT(batch.size(), Eq(4));
+        EXPECT_THAT(batch.packets()[0], Eq(serializeClearEffectSettings(effect).getBytes()));
+        EXPECT_THAT(batch.packets()[3], Eq(serializeAmpSettingsUsbGain(amp).getBytes()));
+    }
+
+    TEST_F(CommandBatchTest, setSignalChainWritesAmpAndEveryDsp)
+    {
+        constexpr fx_pedal_settings effect{FxSlot{3}, effects::MONO_DELAY, 8, 7, 6, 5, 4, 3};
+        const auto clear = [](effects e)
+        { return serializeClearEffectSettings(fx_pedal_settings{FxSlot{0}, e, 0, 0, 0, 0, 0, 0, false}).getBytes(); };
+        const SignalChain chain{"abc", amp, {effect}};
+        CommandBatch batch;
+        batch.set_signal_chain(chain);
+
+        EXPECT_THAT(batch.packets(), ElementsAre(serializeAmpSettings(amp).getBytes(),
+                                                 serializeAmpSettingsUsbGain(amp).getBytes(),
+                                                 clear(effects::OVERDRIVE),
+                                                 clear(effects::SINE_CHORUS),
+                                                 serializeEffectSettings(effect).getBytes(),
+                                                 clear(effects::SMALL_HALL_REVERB)));
+        ASSERT_THAT(batch.signalChain().has_value(), IsTrue());
+        EXPECT_THAT(batch.signalChain()->name(), StrEq("abc"));
+    }
+
+    TEST_F(CommandBatchTest, setSignalChainSupersedesEarlierWrites)
+    {
+        constexpr fx_pedal_settings effect{FxSlot{1}, effects::SINE_CHORUS, 1, 2, 3, 4, 5, 6};
+        constexpr fx_pedal_settings laterEffect{FxSlot{3}, effects::MONO_DELAY, 8, 7, 6, 5, 4, 3};
+        CommandBatch batch;
+        batch.set_amplifier(amp);
+        batch.set_effect(effect);
+        batch.set_signal_chain(SignalChain{"abc", amp, {}});
+        batch.set_effect(laterEffect);
+
+        EXPECT_THAT(batch.amplifier().has_value(), IsFalse());
+        EXPECT_THAT(batch.effects(), ElementsAre(EffectIs(laterEffect)));
+        EXPECT_THAT(batch.size(), Eq(6 + 2));
+        EXPECT_THAT(batch.packets().front(), Eq(serializeAmpSettings(amp).getBytes()));
+        EXPECT_THAT(batch.packets().back(), Eq(serializeEffectSettings(laterEffect).getBytes()));
+    }
+}
@@ -0,0 +1,121 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "com/CommandExecutor.h"
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <gmock/gmock.h>
+
+namespace plug::test
+{
+    using namespace plug::com;
+    using namespace testing;
+
+    class CommandExecutorTest : public testing::Test
+    {
+    };
+
+
+    TEST_F(CommandExecutorTest, submitReturnsResult)
+    {
+        CommandExecutor executor;
+        auto result = executor.submit([]
+                                      { return 42; });
+        EXPECT_THAT(result.get(), Eq(42));
+    }
+
+    TEST_F(CommandExecutorTest, commandsRunInSubmissionOrder)
+    {
+        std::vector<int> order;
+        {
+            CommandExecutor executor;
+
+            for (int i = 0; i < 10; ++i)
+            {
+                executor.submit([&order, i]
+                                { order.push_back(i); });
+            }
+        }
+        EXPECT_THAT(order, ElementsAre(0, 1, 2, 3, 4, 5, 6, 7, 8, 9));
+    }
+
+    TEST_F(CommandExecutorTest, commandsRunOnWorkerThread)
+    {
+        CommandExecutor executor;
+        EXPECT_THAT(executor.isWorkerThread(), IsFalse());
+
+        auto result = executor.submit([&executor]
+                                      { return executor.isWorkerThread(); });
+        EXPECT_THAT(result.get(), IsTrue());
+    }
+
+    TEST_F(CommandExecutorTest, exceptionIsPassedToFuture)
+    {
+        CommandExecutor executor;
+        auto result = executor.submit([]
+                                      { throw std::runtime_error{"expected"}; });
+        EXPECT_THROW(result.get(), std::runtime_error);
+
+        auto next = executor.submit([]
+                                    { return true; });
+        EXPECT_THAT(next.get(), IsTrue());
+    }
+
+    TEST_F(CommandExecutorTest, pendingCommandsRunOnDestruction)
+    {
+        std::promise<void> release;
+        auto released = release.get_future().share();
+        std::future<int> result;
+        {
+            CommandExecutor executor;
+            executor.submit([released]
+                            { released.wait(); });
+            result = executor.submit([]
+                                     { return 3; });
+            EXPECT_THAT(executor.pending(), Ge(1));
+            release.set_value();
+        }
+        EXPECT_THAT(result.get(), Eq(3));
+    }
+
+    TEST_F(CommandExecutorTest, commandsFromManyThreadsAreAllRun)
+    {
+        std::atomic<int> count{0};
+        {
+            CommandExecutor executor;
+            std::vector<std::thread> threads;
+
+            for (int t = 0; t < 4; ++t)
+            {
+                threads.emplace_back([&executor, &count]
+                                     {
+                    for (int i = 0; i < 250; ++i)
+                    {
+                        executor.submit([&count]
+                                        { ++count; });
+                    } });
+            }
+            std::for_each(threads.begin(), threads.end(), [](auto& t)
+                          { t.join(); });
+        }
+        EXPECT_THAT(count.load(), Eq(1000));
+    }
+}
@@ -48,6 +48,7 @@ namespace plug::test
 
         mock::UsbContextMock* contextMock{nullptr};
         mock::UsbDeviceMock* deviceMock{nullptr};
+        std::shared_ptr<usb::Context> context{std::make_shared<usb::Context>()};
     };
 
 
@@ -61,9 +62,9 @@ namespace plug::test
     TEST_F(ConnectionFactoryTest, connectReturnsFirstDeviceFound)
     {
         std::vector<usb::Device> devices{};
-        devices.emplace_back(nullptr);
-        devices.emplace_back(nullptr);
-        devices.emplace_back(nullptr);
+        devices.emplace_back(nullptr, context);
+        devices.emplace_back(nullptr, context);
+        devices.emplace_back(nullptr, context);
         EXPECT_CALL(*contextMock, listDevices).WillOnce(Return(ByMove(std::move(devices))));
         EXPECT_CALL(*deviceMock, open());
         EXPECT_CALL(*deviceMock, name());
@@ -78,4 +79,90 @@ namespace plug::test
         EXPECT_THAT(device, NotNull());
     }
 
+    TEST_F(ConnectionFactoryTest, connectSetsDeviceIdentity)
+    {
+        std::vector<usb::Device> devices{};
+        devices.emplace_back(nullptr, context);
+        EXPECT_CALL(*contextMock, listDevices).WillOnce(Return(ByMove(std::move(devices))));
+        EXPECT_CALL(*deviceMock, open());
+        EXPECT_CALL(*deviceMock, name()).WillOnce(Return("Mustang III"));
+        EXPECT_CALL(*deviceMock, location()).WillOnce(Return("1-2.3"));
+        EXPECT_CALL(*deviceMock, vendorId()).WillOnce(Return(0x1ed8));
+        EXPECT_CALL(*deviceMock, productId()).WillRepeatedly(Return(0x0005));
+
+        const auto identity = connect()->getDeviceIdentity();
+        EXPECT_THAT(identity.vendorId, Eq(0x1ed8));
+        EXPECT_THAT(identity.productId, Eq(0x0005));
+        EXPECT_THAT(identity.name, StrEq("Mustang III"));
+        EXPECT_THAT(identity.location, StrEq("1-2.3"));
+    }
+
+    TEST_F(ConnectionFactoryTest, connectSetsKnobPresetsOfModel)
+    {
+        std::vector<usb::Device> devices{};
+        devices.emplace_back(nullptr, context);
+        EXPECT_CALL(*contextMock, listDevices).WillOnce(Return(ByMove(std::move(devices))));
+        EXPECT_CALL(*deviceMock, open());
+        EXPECT_CALL(*deviceMock, name());
+        EXPECT_CALL(*deviceMock, vendorId()).WillOnce(Return(0x1ed8));
+        EXPECT_CALL(*deviceMock, productId()).WillRepeatedly(Return(0x0004));
+
+        const auto model = connect()->getDeviceModel();
+        EXPECT_THAT(model.numberOfPresets(), Eq(24));
+        EXPECT_THAT(model.numberOfModPresets(), Eq(12));
+        EXPECT_THAT(model.numberOfDlyRevPresets(), Eq(12));
+    }
+
+
+    TEST_F(ConnectionFactoryTest, connectAllConnectsEveryAmp)
+    {
+        std::vector<usb::Device> devices{};
+        devices.emplace_back(nullptr, context);
+        devices.emplace_back(nullptr, context);
+        devices.emplace_back(nullptr, context);
+        EXPECT_CALL(*contextMock, listDevices).WillOnce(Return(ByMove(std::move(devices))));
+        EXPECT_CALL(*deviceMock, vendorId())
+            .WillOnce(Return(0xf0f0))
+            .WillRepeatedly(Return(0x1ed8));
+        EXPECT_CALL(*deviceMock, productId()).WillRepeatedly(Return(0x0005));
+        EXPECT_CALL(*deviceMock, open()).Times(2);
+        EXPECT_CALL(*deviceMock, name()).Times(2);
+
+        const auto amps = connectAll();
+        EXPECT_THAT(amps.size(), Eq(2));
+    }
+
+    TEST_F(ConnectionFactoryTest, connectAllThrowsIfNoDeviceFound)
+    {
+        EXPECT_CALL(*contextMock, listDevices).WillOnce(Return(ByMove(std::vector<usb::Device>{})));
+
+        EXPECT_THROW(connectAll(), CommunicationException);
+    }
+
+    TEST_F(ConnectionFactoryTest, connectDeviceThrowsOnUnknownDevice)
+    {
+        EXPECT_CALL(*deviceMock, vendorId()).WillRepeatedly(Return(0xf0f0));
+        EXPECT_CALL(*deviceMock, productId()).WillRepeatedly(Return(0x0005));
+        EXPECT_CALL(*deviceMock, open()).Times(0);
+
+        EXPECT_THROW(connect(usb::Device{nullptr, context}, [](const AmpEvent&) {}), CommunicationException);
+    }
+
+    TEST_F(ConnectionFactoryTest, watchAmpsRegistersKnownAmps)
+    {
+        EXPECT_CALL(*contextMock, hasHotplug()).WillOnce(Return(true));
+        EXPECT_CALL(*contextMock, registerHotplug(0x1ed8, ElementsAre(0x0004, 0x0005, 0x000a, 0x0010, 0x0012, 0x0014, 0x0016)));
+        EXPECT_CALL(*contextMock, deregisterHotplug());
+
+        auto hotplug = watchAmps([](usb::Hotplug::Event, usb::Device) {});
+        EXPECT_THAT(hotplug, NotNull());
+    }
+
+    TEST_F(ConnectionFactoryTest, watchAmpsReturnsNullWithoutHotplugSupport)
+    {
+        EXPECT_CALL(*contextMock, hasHotplug()).WillOnce(Return(false));
+        EXPECT_CALL(*contextMock, registerHotplug(_, _)).Times(0);
+
+        EXPECT_THAT(watchAmps([](usb::Hotplug::Event, usb::Device) {}), IsNull());
+    }
 }
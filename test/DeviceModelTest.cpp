@@ -34,5 +34,14 @@ namespace plug::test
         EXPECT_EQ(model.name(), "Mustang I");
         EXPECT_EQ(model.category(), DeviceModel::Category::MustangV1);
         EXPECT_EQ(model.numberOfPresets(), 100);
+        EXPECT_EQ(model.numberOfModPresets(), 0);
+        EXPECT_EQ(model.numberOfDlyRevPresets(), 0);
+    }
+
+    TEST_F(DeviceModelTest, knobPresets)
+    {
+        const DeviceModel model{"Mustang I", DeviceModel::Category::MustangV1, 24, 12, 8};
+        EXPECT_EQ(model.numberOfModPresets(), 12);
+        EXPECT_EQ(model.numberOfDlyRevPresets(), 8);
     }
 }
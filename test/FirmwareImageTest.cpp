@@ -0,0 +1,144 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "com/FirmwareImage.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <stdexcept>
+#include <gmock/gmock.h>
+
+namespace plug::test
+{
+    using namespace plug::com;
+    using namespace testing;
+    using namespace std::chrono_literals;
+
+    namespace
+    {
+        std::vector<std::uint8_t> createImage(std::size_t payloadSize)
+        {
+            std::vector<std::uint8_t> image(0x110 + payloadSize, 0xff);
+            const std::string date{"Mar 12 2013"};
+            std::copy(date.cbegin(), date.cend(), std::next(image.begin(), 0x1a));
+            std::iota(std::next(image.begin(), 0x110), image.end(), std::uint8_t{0x01});
+            return image;
+        }
+
+        PacketRawType packet(std::initializer_list<std::uint8_t> header, std::span<const std::uint8_t> data = {})
+        {
+            PacketRawType result{};
+            std::copy(header.begin(), header.end(), result.begin());
+            std::copy(data.begin(), data.end(), std::next(result.begin(), 4));
+            return result;
+        }
+    }
+
+
+    class FirmwareImageTest : public testing::Test
+    {
+    };
+
+
+    TEST_F(FirmwareImageTest, parsesDateAndPayload)
+    {
+        const FirmwareImage image{createImage(100)};
+
+        EXPECT_THAT(image.date(), StrEq("Mar 12 2013"));
+        EXPECT_THAT(image.payloadSize(), Eq(100));
+    }
+
+    TEST_F(FirmwareImageTest, packetsContainDateChunksAndFinishPacket)
+    {
+        const auto data = createImage(100);
+        const std::span<const std::uint8_t> payload{std::next(data.cbegin(), 0x110), data.cend()};
+        const FirmwareImage image{data};
+
+        EXPECT_THAT(image.packets(), ElementsAre(packet({0x02, 0x03, 0x01, 0x06}, std::span{data}.subspan(0x1a, 11)),
+                                                 packet({0x03, 0x03, 0x00, 56}, payload.first(56)),
+                                                 packet({0x03, 0x03, 0x01, 44}, payload.subspan(56)),
+                                                 packet({0x04, 0x03})));
+    }
+
+    TEST_F(FirmwareImageTest, chunksAreNumbered)
+    {
+        const FirmwareImage image{createImage(300 * 56 + 1)};
+        const auto& packets = image.packets();
+
+        ASSERT_THAT(packets, SizeIs(303));
+        EXPECT_THAT(packets[1][2], Eq(0));
+        EXPECT_THAT(packets[2][2], Eq(1));
+        EXPECT_THAT(packets[256][2], Eq(255));
+        EXPECT_THAT(packets[257][2], Eq(0));
+    }
+
+    TEST_F(FirmwareImageTest, payloadFillingLastChunkIsFollowedByEmptyChunk)
+    {
+        const FirmwareImage image{createImage(112)};
+        const auto& packets = image.packets();
+
+        ASSERT_THAT(packets, SizeIs(5));
+        EXPECT_THAT(packets[2][3], Eq(56));
+        EXPECT_THAT(packets[3], Eq(packet({0x03, 0x03, 0x02, 0x00})));
+    }
+
+    TEST_F(FirmwareImageTest, throwsIfTooSmall)
+    {
+        EXPECT_THROW(FirmwareImage{std::vector<std::uint8_t>(0x110, 0x20)}, std::invalid_argument);
+        EXPECT_THROW(FirmwareImage{std::vector<std::uint8_t>{}}, std::invalid_argument);
+    }
+
+    TEST_F(FirmwareImageTest, throwsOnInvalidDate)
+    {
+        auto data = createImage(100);
+        data[0x1a + 3] = 0x00;
+
+        EXPECT_THROW(FirmwareImage{data}, std::invalid_argument);
+    }
+
+    TEST_F(FirmwareImageTest, estimateDurationScalesWithPackets)
+    {
+        const FirmwareImage image{createImage(100)};
+
+        EXPECT_THAT(image.estimateDuration(), Eq(8ms));
+        EXPECT_THAT(image.estimateDuration(500us), Eq(2ms));
+    }
+
+    TEST_F(FirmwareImageTest, loadFirmwareImageMapsFile)
+    {
+        const auto filename = std::filesystem::temp_directory_path() / "plug-test-image.upd";
+        const auto data = createImage(100);
+        {
+            std::ofstream file{filename, std::ios::binary};
+            file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+        }
+
+        const auto image = loadFirmwareImage(filename.string());
+        std::filesystem::remove(filename);
+
+        EXPECT_THAT(image.packets(), Eq(FirmwareImage{data}.packets()));
+    }
+
+    TEST_F(FirmwareImageTest, loadFirmwareImageThrowsIfFileCantBeOpened)
+    {
+        EXPECT_THROW(loadFirmwareImage("/nonexistent/firmware.upd"), std::runtime_error);
+    }
+}
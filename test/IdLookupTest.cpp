@@ -125,4 +125,85 @@ namespace plug::test
     {
         EXPECT_THROW(lookupCabinetById(0xff), std::invalid_argument);
     }
+
+    TEST_F(IdLookupTest, findByIdReturnsNothingOnInvalidId)
+    {
+        static_assert(findAmpById(0x00) == std::nullopt);
+        static_assert(findEffectById(0xff) == std::nullopt);
+        static_assert(findCabinetById(0xff) == std::nullopt);
+        static_assert(findAmpById(0xf1) == amps::STUDIO_PREAMP);
+        EXPECT_EQ(findEffectById(0x2b), effects::TAPE_DELAY);
+    }
+
+    TEST_F(IdLookupTest, modelsMapBothWays)
+    {
+        for (const auto& model : ampModels)
+        {
+            EXPECT_EQ(lookupAmpById(ampModel(model.model).id), model.model);
+        }
+        for (const auto& model : effectModels)
+        {
+            EXPECT_EQ(lookupEffectById(effectModel(model.model).id), model.model);
+        }
+        for (const auto& model : cabinetModels)
+        {
+            EXPECT_EQ(lookupCabinetById(cabinetModel(model.model).id), model.model);
+        }
+    }
+
+    TEST_F(IdLookupTest, modelConstants)
+    {
+        static_assert(ampModel(amps::BRITISH_WATTS).id == 0xff);
+        static_assert(ampModel(amps::FENDER_65_DELUXE_REVERB).unknown == 0x00);
+        static_assert(ampModel(amps::METAL_2000).ampSpecific == 0x08);
+        static_assert(ampModel(amps::METAL_2000).ampSpecificLast == 0x75);
+        static_assert(effectModel(effects::PITCH_SHIFTER).unknown == std::array<std::uint8_t, 3>{0x01, 0x08, 0x01});
+        EXPECT_EQ(cabinetModel(cabinets::cabSS112).id, 0x0c);
+    }
+
+    TEST_F(IdLookupTest, effectModelMetadata)
+    {
+        static_assert(effectModel(effects::EMPTY).family == EffectFamily::none);
+        static_assert(effectModel(effects::EMPTY).knobCount() == 0);
+        static_assert(effectModel(effects::COMPRESSOR).family == EffectFamily::stomp);
+        static_assert(effectModel(effects::PITCH_SHIFTER).family == EffectFamily::modulation);
+        static_assert(effectModel(effects::MONO_DELAY).family == EffectFamily::delay);
+        static_assert(effectModel(effects::SMALL_HALL_REVERB).family == EffectFamily::reverb);
+        static_assert(effectModel(effects::SIMPLE_COMP).knobCount() == 1);
+        static_assert(effectModel(effects::SIMPLE_COMP).knobs[0].max == 3);
+        static_assert(effectModel(effects::MULTITAP_DELAY).knobs[4].max == 3);
+        static_assert(effectModel(effects::TAPE_DELAY).knobCount() == 6);
+        EXPECT_EQ(std::string_view{effectModel(effects::STEP_FILTER).knobs[3].name}, "Minimum Frequency");
+    }
+
+    TEST_F(IdLookupTest, effectModelsHaveConsistentKnobs)
+    {
+        for (const auto& model : effectModels)
+        {
+            EXPECT_EQ(model.name.empty(), false);
+
+            for (std::size_t i = 0; i < model.knobs.size(); ++i)
+            {
+                const auto& knob = model.knobs[i];
+                EXPECT_EQ(knob.label == nullptr, knob.max == 0);
+                EXPECT_EQ(knob.name == nullptr, knob.max == 0);
+                EXPECT_LE(model.defaults[i], knob.max);
+            }
+        }
+    }
+
+    TEST_F(IdLookupTest, ampModelThrowsOnInvalidAmp)
+    {
+        EXPECT_THROW(ampModel(static_cast<amps>(ampModels.size())), std::invalid_argument);
+    }
+
+    TEST_F(IdLookupTest, cabinetModelThrowsOnInvalidCabinet)
+    {
+        EXPECT_THROW(cabinetModel(static_cast<cabinets>(cabinetModels.size())), std::invalid_argument);
+    }
+
+    TEST_F(IdLookupTest, effectModelThrowsOnInvalidEffect)
+    {
+        EXPECT_THROW(effectModel(static_cast<effects>(effectModels.size())), std::invalid_argument);
+    }
 }
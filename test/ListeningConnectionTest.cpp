@@ -0,0 +1,378 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "com/ListeningConnection.h"
+#include "com/PacketSerializer.h"
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <gmock/gmock.h>
+
+namespace plug::test
+{
+    using namespace plug::com;
+    using namespace testing;
+    using namespace std::chrono_literals;
+
+    namespace
+    {
+        // Completes the posted transfers in order like the USB stack does; a
+        // transfer without data completes empty after its timeout
+        class FakeAmpConnection : public Connection
+        {
+        public:
+            FakeAmpConnection()
+                : running(true), thread([this]
+                                        { run(); })
+            {
+            }
+
+            ~FakeAmpConnection() override
+            {
+                {
+                    std::lock_guard lock{mutex};
+                    running = false;
+                }
+                changed.notify_all();
+                thread.join();
+            }
+
+            void close() override
+            {
+            }
+
+            bool isOpen() const override
+            {
+                return true;
+            }
+
+            std::vector<std::uint8_t> receive([[maybe_unused]] std::size_t recvSize) override
+            {
+                return {};
+            }
+
+            std::string name() const override
+            {
+                return "fake";
+            }
+
+            void push(const PacketRawType& packet)
+            {
+                std::lock_guard lock{mutex};
+                incoming.push_back(packet);
+                changed.notify_all();
+            }
+
+            void answerSendsWith(const PacketRawType& packet)
+            {
+                std::lock_guard lock{mutex};
+                response = packet;
+            }
+
+            bool waitForPosted(std::size_t count)
+            {
+                std::unique_lock lock{mutex};
+                return changed.wait_for(lock, 2s, [this, count]
+                                        { return transfers.size() >= count; });
+            }
+
+        private:
+            struct Transfer
+            {
+                std::uint8_t* data;
+                std::size_t size;
+                std::promise<std::size_t> result;
+                std::chrono::steady_clock::time_point posted;
+            };
+
+            std::future<std::size_t> receiveAsyncImpl(std::uint8_t* data, std::size_t size) override
+            {
+                std::lock_guard lock{mutex};
+                transfers.push_back(Transfer{data, size, {}, std::chrono::steady_clock::now()});
+                changed.notify_all();
+                return transfers.back().result.get_future();
+            }
+
+            std::size_t sendImpl([[maybe_unused]] const std::uint8_t* data, std::size_t size) override
+            {
+                std::lock_guard lock{mutex};
+
+                if (response)
+                {
+                    incoming.push_back(*response);
+                    changed.notify_all();
+                }
+                return size;
+            }
+
+            void run()
+            {
+                std::unique_lock lock{mutex};
+
+                while (running)
+                {
+                    changed.wait_for(lock, 5ms);
+
+                    while (!transfers.empty() && !incoming.empty())
+                    {
+                        auto& transfer = transfers.front();
+                        const auto n = std::min(transfer.size, incoming.front().size());
+                        std::copy_n(incoming.front().cbegin(), n, transfer.data);
+                        transfer.result.set_value(n);
+                        transfers.pop_front();
+                        incoming.pop_front();
+                    }
+
+                    while (!transfers.empty() && ((std::chrono::steady_clock::now() - transfers.front().posted) > 50ms))
+                    {
+                        transfers.front().result.set_value(0);
+                        transfers.pop_front();
+                    }
+                }
+
+                std::for_each(transfers.begin(), transfers.end(), [](auto& transfer)
+                              { transfer.result.set_value(0); });
+            }
+
+            std::mutex mutex;
+            std::condition_variable changed;
+            std::deque<Transfer> transfers;
+            std::deque<PacketRawType> incoming;
+            std::optional<PacketRawType> response;
+            bool running;
+            std::thread thread;
+        };
+    }
+
+
+    class ListeningConnectionTest : public testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            fake = std::make_shared<FakeAmpConnection>();
+            listener = std::make_unique<ListeningConnection>(fake, [this](const AmpEvent& ampEvent)
+                                                             {
+                                                                 std::lock_guard lock{mutex};
+                                                                 events.push_back(ampEvent);
+                                                                 received.notify_all();
+                                                             });
+        }
+
+        void TearDown() override
+        {
+            listener.reset();
+        }
+
+        std::vector<AmpEvent> waitForEvents(std::size_t count)
+        {
+            std::unique_lock lock{mutex};
+            received.wait_for(lock, 2s, [this, count]
+                              { return events.size() >= count; });
+            return events;
+        }
+
+        static amp_settings ampWithGain(std::uint8_t gain)
+        {
+            amp_settings settings{};
+            settings.amp_num = amps::BRITISH_80S;
+            settings.cabinet = cabinets::cab4x12M;
+            settings.gain = gain;
+            return settings;
+        }
+
+        static PacketRawType ack()
+        {
+            return PacketRawType{{0x1c, 0x03}};
+        }
+
+        static PacketRawType streamPacket(PacketRawType packet, std::uint8_t dsp, std::uint8_t slot)
+        {
+            packet[0] = 0x1c;
+            packet[1] = 0x01;
+            packet[2] = dsp;
+            packet[3] = 0x00;
+            packet[4] = slot;
+            return packet;
+        }
+
+        std::shared_ptr<FakeAmpConnection> fake;
+        std::unique_ptr<ListeningConnection> listener;
+        std::mutex mutex;
+        std::condition_variable received;
+        std::vector<AmpEvent> events;
+    };
+
+
+    TEST_F(ListeningConnectionTest, keepsTransfersPosted)
+    {
+        EXPECT_THAT(fake->waitForPosted(4), IsTrue());
+    }
+
+    TEST_F(ListeningConnectionTest, receiveReturnsResponseOfSend)
+    {
+        fake->answerSendsWith(ack());
+        const PacketRawType request{{0x1c, 0x03, 0x05}};
+
+        listener->send(request);
+        const auto response = listener->receive(packetRawTypeSize);
+
+        EXPECT_THAT(response, ElementsAreArray(ack()));
+    }
+
+    TEST_F(ListeningConnectionTest, receiveIntoBufferReturnsResponseOfSend)
+    {
+        fake->answerSendsWith(ack());
+        PacketRawType response{};
+
+        listener->send(PacketRawType{{0x1c, 0x03, 0x05}});
+        const auto size = listener->receive(std::span{response});
+
+        EXPECT_THAT(size, Eq(packetRawTypeSize));
+        EXPECT_THAT(response, ElementsAreArray(ack()));
+    }
+
+    TEST_F(ListeningConnectionTest, receiveReturnsNothingWithoutResponse)
+    {
+        EXPECT_THAT(listener->receive(packetRawTypeSize), IsEmpty());
+    }
+
+    TEST_F(ListeningConnectionTest, ampChangeIsReportedAsEvent)
+    {
+        fake->push(serializeAmpSettings(ampWithGain(0x77)).getBytes());
+
+        const auto result = waitForEvents(1);
+        ASSERT_THAT(result.size(), Eq(1));
+        ASSERT_THAT(std::holds_alternative<event::AmpChanged>(result[0]), IsTrue());
+        EXPECT_THAT(std::get<event::AmpChanged>(result[0]).amp.amp_num, Eq(amps::BRITISH_80S));
+        EXPECT_THAT(std::get<event::AmpChanged>(result[0]).amp.gain, Eq(0x77));
+    }
+
+    TEST_F(ListeningConnectionTest, usbGainChangeIsReportedAsEvent)
+    {
+        auto settings = ampWithGain(0x77);
+        settings.usb_gain = 0x44;
+        auto usbGain = serializeAmpSettingsUsbGain(settings).getBytes();
+        usbGain[2] = usbGainReportDsp;
+        fake->push(serializeAmpSettings(settings).getBytes());
+        fake->push(usbGain);
+
+        const auto result = waitForEvents(2);
+        ASSERT_THAT(result.size(), Eq(2));
+        ASSERT_THAT(std::holds_alternative<event::AmpChanged>(result[1]), IsTrue());
+        EXPECT_THAT(std::get<event::AmpChanged>(result[1]).amp.gain, Eq(0x77));
+        EXPECT_THAT(std::get<event::AmpChanged>(result[1]).amp.usb_gain, Eq(0x44));
+    }
+
+    TEST_F(ListeningConnectionTest, effectChangeIsReportedAsEvent)
+    {
+        const fx_pedal_settings effect{FxSlot{2}, effects::SINE_CHORUS, 0x11, 0x22, 0x33, 0x44, 0x55, 0x00, true};
+        fake->push(serializeEffectSettings(effect).getBytes());
+
+        const auto result = waitForEvents(1);
+        ASSERT_THAT(result.size(), Eq(1));
+        ASSERT_THAT(std::holds_alternative<event::EffectChanged>(result[0]), IsTrue());
+        const auto actual = std::get<event::EffectChanged>(result[0]).effect;
+        EXPECT_THAT(actual.effect_num, Eq(effects::SINE_CHORUS));
+        EXPECT_THAT(actual.slot.id(), Eq(2));
+        EXPECT_THAT(actual.knob3, Eq(0x33));
+    }
+
+    TEST_F(ListeningConnectionTest, changeWithUnknownModelIsDropped)
+    {
+        auto unknown = serializeEffectSettings({FxSlot{1}, effects::OVERDRIVE, 0, 0, 0, 0, 0, 0, true});
+        MutablePacketView<EffectPayload>{unknown}.getPayload().setModel(0xee);
+        fake->push(unknown.getBytes());
+        fake->push(serializeEffectSettings({FxSlot{2}, effects::SINE_CHORUS, 0, 0, 0, 0, 0, 0, true}).getBytes());
+
+        const auto result = waitForEvents(1);
+        ASSERT_THAT(result.size(), Eq(1));
+        ASSERT_THAT(std::holds_alternative<event::EffectChanged>(result[0]), IsTrue());
+        EXPECT_THAT(std::get<event::EffectChanged>(result[0]).effect.effect_num, Eq(effects::SINE_CHORUS));
+    }
+
+    TEST_F(ListeningConnectionTest, changeDuringExchangeIsNoResponse)
+    {
+        listener->send(PacketRawType{{0x1c, 0x03, 0x05}});
+        fake->push(serializeAmpSettings(ampWithGain(0x10)).getBytes());
+        fake->push(ack());
+
+        EXPECT_THAT(listener->receive(packetRawTypeSize), ElementsAreArray(ack()));
+        EXPECT_THAT(waitForEvents(1).size(), Eq(1));
+    }
+
+    TEST_F(ListeningConnectionTest, responseWithUnknownHeaderIsReceived)
+    {
+        const PacketRawType unknown{{0x1c, 0xee, 0xee}};
+        fake->answerSendsWith(unknown);
+
+        listener->send(PacketRawType{{0x1c, 0x03, 0x05}});
+
+        EXPECT_THAT(listener->receive(packetRawTypeSize), ElementsAreArray(unknown));
+    }
+
+    TEST_F(ListeningConnectionTest, failingHandlerKeepsListening)
+    {
+        listener.reset();
+        listener = std::make_unique<ListeningConnection>(fake, [](const AmpEvent&)
+                                                         { throw std::runtime_error{"handler failed"}; });
+        fake->push(serializeAmpSettings(ampWithGain(0x10)).getBytes());
+        std::this_thread::sleep_for(50ms);
+        fake->answerSendsWith(ack());
+
+        listener->send(PacketRawType{{0x1c, 0x03, 0x05}});
+
+        EXPECT_THAT(listener->receive(packetRawTypeSize), ElementsAreArray(ack()));
+    }
+
+    TEST_F(ListeningConnectionTest, presetSelectedOnAmpIsReported)
+    {
+        fake->push(streamPacket(serializeName(0, "abc").getBytes(), 0x04, 7));
+        fake->push(streamPacket(serializeAmpSettings(ampWithGain(0x30)).getBytes(), 0x05, 7));
+        fake->push(streamPacket(PacketRawType{}, 0x00, 7));
+
+        const auto result = waitForEvents(1);
+        ASSERT_THAT(result.size(), Eq(1));
+        ASSERT_THAT(std::holds_alternative<event::PresetSelected>(result[0]), IsTrue());
+        const auto& selected = std::get<event::PresetSelected>(result[0]);
+        EXPECT_THAT(selected.slot, Eq(7));
+        EXPECT_THAT(selected.signalChain.name(), StrEq("abc"));
+        EXPECT_THAT(selected.signalChain.amp().gain, Eq(0x30));
+    }
+
+    TEST_F(ListeningConnectionTest, staleResponsesAreDroppedOnSend)
+    {
+        fake->answerSendsWith(ack());
+        listener->send(PacketRawType{{0x1c, 0x03, 0x05}});
+        std::this_thread::sleep_for(100ms);
+
+        PacketRawType secondResponse{{0x1c, 0x03, 0x00, 0x00, 0x01}};
+        fake->answerSendsWith(secondResponse);
+        listener->send(PacketRawType{{0x1c, 0x03, 0x06}});
+
+        EXPECT_THAT(listener->receive(packetRawTypeSize), ElementsAreArray(secondResponse));
+    }
+}
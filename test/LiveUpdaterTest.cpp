@@ -0,0 +1,181 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "com/LiveUpdater.h"
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <vector>
+#include <gmock/gmock.h>
+
+namespace plug::test
+{
+    using namespace plug::com;
+    using namespace testing;
+    using namespace std::chrono_literals;
+
+    class LiveUpdaterTest : public testing::Test
+    {
+    protected:
+        LiveUpdater::Send recordingSend()
+        {
+            return [this](const CommandBatch& batch)
+            {
+                std::unique_lock lock{mutex};
+                batches.push_back(batch);
+                sent.notify_all();
+                sent.wait(lock, [this]
+                          { return !holdTransfers; });
+            };
+        }
+
+        void waitForBatches(std::size_t count)
+        {
+            std::unique_lock lock{mutex};
+            ASSERT_TRUE(sent.wait_for(lock, 2s, [this, count]
+                                      { return batches.size() >= count; }));
+        }
+
+        void releaseTransfers()
+        {
+            {
+                std::lock_guard lock{mutex};
+                holdTransfers = false;
+            }
+            sent.notify_all();
+        }
+
+        static amp_settings ampWithGain(std::uint8_t gain)
+        {
+            amp_settings settings{};
+            settings.amp_num = amps::BRITISH_80S;
+            settings.cabinet = cabinets::cab4x12M;
+            settings.gain = gain;
+            return settings;
+        }
+
+        std::mutex mutex;
+        std::condition_variable sent;
+        std::vector<CommandBatch> batches;
+        bool holdTransfers{false};
+        static constexpr unsigned int unlimitedRate{1000};
+    };
+
+
+    TEST_F(LiveUpdaterTest, updateIsSent)
+    {
+        LiveUpdater updater{recordingSend(), unlimitedRate};
+        updater.update(ampWithGain(3));
+
+        waitForBatches(1);
+        std::lock_guard lock{mutex};
+        ASSERT_THAT(batches[0].amplifier().has_value(), IsTrue());
+        EXPECT_THAT(batches[0].amplifier()->gain, Eq(3));
+    }
+
+    TEST_F(LiveUpdaterTest, updatesWhileInFlightAreCoalesced)
+    {
+        holdTransfers = true;
+        LiveUpdater updater{recordingSend(), unlimitedRate};
+        updater.update(ampWithGain(0));
+        waitForBatches(1);
+
+        for (std::uint8_t gain = 1; gain <= 10; ++gain)
+        {
+            updater.update(ampWithGain(gain));
+        }
+        releaseTransfers();
+        waitForBatches(2);
+
+        std::lock_guard lock{mutex};
+        EXPECT_THAT(batches.size(), Eq(2));
+        EXPECT_THAT(batches[1].amplifier()->gain, Eq(10));
+        EXPECT_THAT(updater.stats().updates, Eq(11));
+        EXPECT_THAT(updater.stats().coalesced, Eq(9));
+    }
+
+    TEST_F(LiveUpdaterTest, effectsAreCoalescedPerDsp)
+    {
+        holdTransfers = true;
+        LiveUpdater updater{recordingSend(), unlimitedRate};
+        updater.update(ampWithGain(0));
+        waitForBatches(1);
+
+        updater.update(fx_pedal_settings{FxSlot{0}, effects::OVERDRIVE, 1, 0, 0, 0, 0, 0});
+        updater.update(fx_pedal_settings{FxSlot{0}, effects::OVERDRIVE, 2, 0, 0, 0, 0, 0});
+        updater.update(fx_pedal_settings{FxSlot{1}, effects::SINE_CHORUS, 3, 0, 0, 0, 0, 0});
+        releaseTransfers();
+        waitForBatches(2);
+
+        std::lock_guard lock{mutex};
+        const auto& effects = batches[1].effects();
+        ASSERT_THAT(effects.size(), Eq(2));
+        EXPECT_THAT(effects[0].knob1, Eq(2));
+        EXPECT_THAT(effects[1].knob1, Eq(3));
+    }
+
+    TEST_F(LiveUpdaterTest, effectWithoutDspIsIgnored)
+    {
+        LiveUpdater updater{recordingSend(), unlimitedRate};
+        updater.update(fx_pedal_settings{FxSlot{0}, effects::EMPTY, 0, 0, 0, 0, 0, 0});
+
+        EXPECT_THAT(updater.stats().updates, Eq(0));
+    }
+
+    TEST_F(LiveUpdaterTest, transfersAreRateLimited)
+    {
+        constexpr unsigned int rate{20};
+        LiveUpdater updater{recordingSend(), rate};
+        updater.update(ampWithGain(1));
+        waitForBatches(1);
+        const auto first = LiveUpdater::Clock::now();
+
+        updater.update(ampWithGain(2));
+        waitForBatches(2);
+
+        EXPECT_THAT(LiveUpdater::Clock::now() - first, Ge(40ms));
+    }
+
+    TEST_F(LiveUpdaterTest, statsAreReported)
+    {
+        std::promise<LiveStats> reported;
+        LiveUpdater updater{recordingSend(), unlimitedRate, [&reported](const LiveStats& stats)
+                            { reported.set_value(stats); }};
+        updater.update(ampWithGain(1));
+
+        const auto stats = reported.get_future().get();
+        EXPECT_THAT(stats.transfers, Eq(1));
+        EXPECT_THAT(stats.updates, Eq(1));
+        EXPECT_THAT(stats.maxLatency, Ge(stats.averageLatency));
+    }
+
+    TEST_F(LiveUpdaterTest, pendingUpdatesAreSentOnDestruction)
+    {
+        {
+            LiveUpdater updater{recordingSend(), 1};
+            updater.update(ampWithGain(1));
+            waitForBatches(1);
+            updater.update(ampWithGain(2));
+        }
+
+        std::lock_guard lock{mutex};
+        ASSERT_THAT(batches.size(), Eq(2));
+        EXPECT_THAT(batches[1].amplifier()->gain, Eq(2));
+    }
+}
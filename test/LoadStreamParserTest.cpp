@@ -0,0 +1,294 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "com/LoadStreamParser.h"
+#include "com/PacketSerializer.h"
+#include <gmock/gmock.h>
+
+namespace plug::test
+{
+    using namespace plug::com;
+    using namespace testing;
+
+    class LoadStreamParserTest : public testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            events.clear();
+        }
+
+        LoadStreamParser createParser(LoadStreamParser::Stream stream, std::size_t numberModPresets = 0, std::size_t numberDlyRevPresets = 0)
+        {
+            return LoadStreamParser{stream, [this](const load::Event& e)
+                                    { events.push_back(e); },
+                                    DeviceModel{"test", DeviceModel::Category::Other, 0, numberModPresets, numberDlyRevPresets}};
+        }
+
+        static void pushState(LoadStreamParser& parser)
+        {
+            parser.push(namePacket(0, "preset"));
+            parser.push(asStreamPacket(serializeAmpSettings(amp).getBytes(), 0x05));
+            parser.push(confirmation(0x00, 0));
+        }
+
+        static void pushKnobPresets(LoadStreamParser& parser, std::uint8_t knob, std::uint8_t count)
+        {
+            for (std::uint8_t i = 0; i < count; ++i)
+            {
+                parser.push(namePacket(i, "knob preset", knob));
+                parser.push(confirmation(knob, i));
+            }
+        }
+
+        static PacketRawType streamPacket(std::uint8_t dsp, std::uint8_t knob, std::uint8_t slot)
+        {
+            PacketRawType packet{};
+            packet[0] = 0x1c;
+            packet[1] = 0x01;
+            packet[2] = dsp;
+            packet[3] = knob;
+            packet[4] = slot;
+            return packet;
+        }
+
+        static PacketRawType asStreamPacket(PacketRawType packet, std::uint8_t dsp, std::uint8_t knob = 0x00, std::uint8_t slot = 0x00)
+        {
+            const auto header = streamPacket(dsp, knob, slot);
+            std::copy(header.cbegin(), std::next(header.cbegin(), 5), packet.begin());
+            return packet;
+        }
+
+        static PacketRawType namePacket(std::uint8_t slot, std::string_view name, std::uint8_t knob = 0x00)
+        {
+            return asStreamPacket(serializeName(slot, name).getBytes(), 0x04, knob, slot);
+        }
+
+        static PacketRawType confirmation(std::uint8_t knob, std::uint8_t slot)
+        {
+            return streamPacket(0x00, knob, slot);
+        }
+
+        template <class Event>
+        std::size_t count() const
+        {
+            return static_cast<std::size_t>(std::count_if(events.cbegin(), events.cend(), [](const auto& e)
+                                                          { return std::holds_alternative<Event>(e); }));
+        }
+
+        std::vector<load::Event> events;
+        static constexpr std::uint8_t mod{0x01};
+        static constexpr std::uint8_t dlyRev{0x02};
+        static constexpr amp_settings amp{amps::BRITISH_80S, 2, 1, 3, 4, 5,
+                                          cabinets::cab4x12M, 0, 9, 10, 11,
+                                          0, 0x80, 13, 1, false, 0xab};
+    };
+
+
+    TEST_F(LoadStreamParserTest, nameWithConfirmationIsPresetName)
+    {
+        auto parser = createParser(LoadStreamParser::Stream::load);
+        parser.push(namePacket(3, "abc"));
+        EXPECT_THAT(events, IsEmpty());
+
+        parser.push(confirmation(0x00, 3));
+        ASSERT_THAT(events.size(), Eq(1));
+        const auto& preset = std::get<load::PresetName>(events[0]);
+        EXPECT_THAT(preset.slot, Eq(3));
+        EXPECT_THAT(preset.name, StrEq("abc"));
+        EXPECT_THAT(parser.finished(), IsFalse());
+    }
+
+    TEST_F(LoadStreamParserTest, nameFollowedByDataIsCurrentName)
+    {
+        auto parser = createParser(LoadStreamParser::Stream::load);
+        parser.push(namePacket(7, "current"));
+        parser.push(asStreamPacket(serializeAmpSettings(amp).getBytes(), 0x05));
+
+        ASSERT_THAT(events.size(), Eq(2));
+        const auto& name = std::get<load::CurrentName>(events[0]);
+        EXPECT_THAT(name.slot, Eq(7));
+        EXPECT_THAT(name.name, StrEq("current"));
+        EXPECT_THAT(std::holds_alternative<load::AmpState>(events[1]), IsTrue());
+    }
+
+    TEST_F(LoadStreamParserTest, ampAndUsbGainState)
+    {
+        auto parser = createParser(LoadStreamParser::Stream::load);
+        const auto ampPacket = asStreamPacket(serializeAmpSettings(amp).getBytes(), 0x05);
+        const auto usbGainPacket = asStreamPacket(serializeAmpSettingsUsbGain(amp).getBytes(), 0x0a);
+        parser.push(ampPacket);
+        parser.push(usbGainPacket);
+
+        ASSERT_THAT(events.size(), Eq(2));
+        const auto& ampState = std::get<load::AmpState>(events[0]);
+        const auto& usbGainState = std::get<load::UsbGainState>(events[1]);
+        const auto decoded = decodeAmpFromData(ampState.packet, usbGainState.packet);
+        EXPECT_THAT(decoded.amp_num, Eq(amp.amp_num));
+        EXPECT_THAT(decoded.usb_gain, Eq(amp.usb_gain));
+    }
+
+    TEST_F(LoadStreamParserTest, effectStateCarriesDspIndex)
+    {
+        constexpr fx_pedal_settings effect{FxSlot{0x02}, effects::TAPE_DELAY, 1, 2, 3, 4, 5, 6};
+        auto parser = createParser(LoadStreamParser::Stream::load);
+        const auto packet = asStreamPacket(serializeEffectSettings(effect).getBytes(), 0x08);
+        parser.push(packet);
+
+        ASSERT_THAT(events.size(), Eq(1));
+        const auto& state = std::get<load::EffectState>(events[0]);
+        EXPECT_THAT(state.dspIndex, Eq(2));
+        EXPECT_THAT(state.packet.getPayload().getModel(), Eq(serializeEffectSettings(effect).getPayload().getModel()));
+    }
+
+    TEST_F(LoadStreamParserTest, dspOfUsbGainWriteIsNoState)
+    {
+        auto parser = createParser(LoadStreamParser::Stream::load);
+        parser.push(asStreamPacket(serializeAmpSettingsUsbGain(amp).getBytes(), 0x0d));
+
+        EXPECT_THAT(events, IsEmpty());
+    }
+
+    TEST_F(LoadStreamParserTest, knobPresetsAreEmittedOnConfirmation)
+    {
+        auto parser = createParser(LoadStreamParser::Stream::load);
+        parser.push(namePacket(1, "mod preset", mod));
+        parser.push(streamPacket(0x07, mod, 1));
+        EXPECT_THAT(events, IsEmpty());
+        parser.push(confirmation(mod, 1));
+
+        parser.push(namePacket(0, "dly/rev preset", dlyRev));
+        parser.push(streamPacket(0x08, dlyRev, 0));
+        parser.push(streamPacket(0x09, dlyRev, 0));
+        parser.push(confirmation(dlyRev, 0));
+
+        ASSERT_THAT(events.size(), Eq(2));
+        const auto& modPreset = std::get<load::ModKnobPreset>(events[0]);
+        EXPECT_THAT(modPreset.slot, Eq(1));
+        EXPECT_THAT(modPreset.name, StrEq("mod preset"));
+        EXPECT_THAT(modPreset.effects.size(), Eq(1));
+        const auto& dlyRevPreset = std::get<load::DlyRevKnobPreset>(events[1]);
+        EXPECT_THAT(dlyRevPreset.slot, Eq(0));
+        EXPECT_THAT(dlyRevPreset.name, StrEq("dly/rev preset"));
+        EXPECT_THAT(dlyRevPreset.effects.size(), Eq(2));
+    }
+
+    TEST_F(LoadStreamParserTest, loadStreamEndsWithKnobPresetsOfModel)
+    {
+        auto parser = createParser(LoadStreamParser::Stream::load, 2, 2);
+        parser.push(namePacket(0, "preset"));
+        parser.push(confirmation(0x00, 0));
+        parser.push(namePacket(0, "preset"));
+        parser.push(asStreamPacket(serializeAmpSettings(amp).getBytes(), 0x05));
+        parser.push(confirmation(0x00, 0));
+        EXPECT_THAT(count<load::EndOfState>(), Eq(1));
+        EXPECT_THAT(parser.finished(), IsFalse());
+
+        for (std::uint8_t i = 0; i < 2; ++i)
+        {
+            parser.push(namePacket(i, "mod", mod));
+            parser.push(confirmation(mod, i));
+        }
+        EXPECT_THAT(parser.finished(), IsFalse());
+
+        parser.push(namePacket(0, "dly/rev", dlyRev));
+        parser.push(confirmation(dlyRev, 0));
+        EXPECT_THAT(parser.finished(), IsFalse());
+        parser.push(namePacket(1, "dly/rev", dlyRev));
+        parser.push(confirmation(dlyRev, 1));
+
+        EXPECT_THAT(parser.finished(), IsTrue());
+        EXPECT_THAT(count<load::EndOfStream>(), Eq(1));
+        EXPECT_THAT(std::holds_alternative<load::EndOfStream>(events.back()), IsTrue());
+    }
+
+    TEST_F(LoadStreamParserTest, loadStreamEndsWithFewerDlyRevThanModPresets)
+    {
+        auto parser = createParser(LoadStreamParser::Stream::load, 3, 1);
+        pushState(parser);
+        pushKnobPresets(parser, mod, 1);
+        pushKnobPresets(parser, dlyRev, 1);
+        EXPECT_THAT(parser.finished(), IsFalse());
+
+        parser.push(namePacket(1, "mod", mod));
+        parser.push(confirmation(mod, 1));
+        parser.push(namePacket(2, "mod", mod));
+        parser.push(confirmation(mod, 2));
+        EXPECT_THAT(parser.finished(), IsTrue());
+    }
+
+    TEST_F(LoadStreamParserTest, loadStreamEndsWithMoreDlyRevThanModPresets)
+    {
+        auto parser = createParser(LoadStreamParser::Stream::load, 1, 3);
+        pushState(parser);
+        pushKnobPresets(parser, mod, 1);
+        pushKnobPresets(parser, dlyRev, 2);
+        EXPECT_THAT(parser.finished(), IsFalse());
+
+        parser.push(namePacket(2, "dly/rev", dlyRev));
+        parser.push(confirmation(dlyRev, 2));
+        EXPECT_THAT(parser.finished(), IsTrue());
+        EXPECT_THAT(count<load::DlyRevKnobPreset>(), Eq(3));
+    }
+
+    TEST_F(LoadStreamParserTest, loadStreamWithUnknownKnobPresetsDoesNotEnd)
+    {
+        auto parser = createParser(LoadStreamParser::Stream::load);
+        pushState(parser);
+        pushKnobPresets(parser, mod, 4);
+        pushKnobPresets(parser, dlyRev, 4);
+
+        EXPECT_THAT(parser.finished(), IsFalse());
+        EXPECT_THAT(count<load::EndOfStream>(), Eq(0));
+    }
+
+    TEST_F(LoadStreamParserTest, bankStreamEndsWithStateConfirmation)
+    {
+        auto parser = createParser(LoadStreamParser::Stream::bank);
+        parser.push(namePacket(5, "bank"));
+        parser.push(asStreamPacket(serializeAmpSettings(amp).getBytes(), 0x05));
+        EXPECT_THAT(parser.finished(), IsFalse());
+        parser.push(confirmation(0x00, 5));
+
+        EXPECT_THAT(parser.finished(), IsTrue());
+        EXPECT_THAT(count<load::CurrentName>(), Eq(1));
+        EXPECT_THAT(count<load::AmpState>(), Eq(1));
+        EXPECT_THAT(count<load::EndOfState>(), Eq(1));
+        EXPECT_THAT(count<load::EndOfStream>(), Eq(1));
+    }
+
+    TEST_F(LoadStreamParserTest, packetsAfterEndOfStreamAreIgnored)
+    {
+        auto parser = createParser(LoadStreamParser::Stream::bank);
+        parser.push(confirmation(0x00, 0));
+        parser.push(asStreamPacket(serializeAmpSettings(amp).getBytes(), 0x05));
+
+        EXPECT_THAT(events.size(), Eq(2));
+    }
+
+    TEST_F(LoadStreamParserTest, ignoresPacketsOutsideOfStream)
+    {
+        auto parser = createParser(LoadStreamParser::Stream::load);
+        parser.push(PacketRawType{});
+        parser.push(serializeAmpSettings(amp).getBytes());
+
+        EXPECT_THAT(events, IsEmpty());
+        EXPECT_THAT(parser.finished(), IsFalse());
+    }
+}
@@ -0,0 +1,101 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "com/MpscQueue.h"
+#include <thread>
+#include <vector>
+#include <gmock/gmock.h>
+
+namespace plug::test
+{
+    using namespace plug::com;
+    using namespace testing;
+
+    class MpscQueueTest : public testing::Test
+    {
+    };
+
+
+    TEST_F(MpscQueueTest, popReturnsNothingIfEmpty)
+    {
+        MpscQueue<int> queue;
+        EXPECT_THAT(queue.pop(), Eq(std::nullopt));
+    }
+
+    TEST_F(MpscQueueTest, popReturnsValuesInPushOrder)
+    {
+        MpscQueue<int> queue;
+        queue.push(1);
+        queue.push(2);
+        queue.push(3);
+
+        EXPECT_THAT(queue.pop(), Optional(1));
+        EXPECT_THAT(queue.pop(), Optional(2));
+        EXPECT_THAT(queue.pop(), Optional(3));
+        EXPECT_THAT(queue.pop(), Eq(std::nullopt));
+    }
+
+    TEST_F(MpscQueueTest, destructionReleasesRemainingValues)
+    {
+        auto value = std::make_shared<int>(1);
+        {
+            MpscQueue<std::shared_ptr<int>> queue;
+            queue.push(value);
+            queue.push(value);
+            EXPECT_THAT(value.use_count(), Eq(3));
+        }
+        EXPECT_THAT(value.use_count(), Eq(1));
+    }
+
+    TEST_F(MpscQueueTest, concurrentPushesKeepOrderPerProducer)
+    {
+        constexpr int producers{4};
+        constexpr int values{1000};
+        MpscQueue<std::pair<int, int>> queue;
+        std::vector<std::thread> threads;
+
+        for (int p = 0; p < producers; ++p)
+        {
+            threads.emplace_back([&queue, p]
+                                 {
+                for (int i = 0; i < values; ++i)
+                {
+                    queue.push({p, i});
+                } });
+        }
+
+        std::vector<int> next(producers, 0);
+        int received{0};
+
+        while (received < producers * values)
+        {
+            if (const auto value = queue.pop(); value)
+            {
+                EXPECT_THAT(value->second, Eq(next[value->first]));
+                next[value->first] = value->second + 1;
+                ++received;
+            }
+        }
+
+        std::for_each(threads.begin(), threads.end(), [](auto& t)
+                      { t.join(); });
+        EXPECT_THAT(queue.pop(), Eq(std::nullopt));
+    }
+}
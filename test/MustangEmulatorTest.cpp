@@ -0,0 +1,384 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "emulator/MustangEmulator.h"
+#include "com/Mustang.h"
+#include "com/PacketSerializer.h"
+#include "com/CommunicationException.h"
+#include "ui/edit_tracker.h"
+#include "matcher/TypeMatcher.h"
+#include <chrono>
+#include <gmock/gmock.h>
+
+namespace plug::test
+{
+    using namespace plug::com;
+    using namespace plug::test::matcher;
+    using plug::test::emulator::MustangEmulator;
+    using namespace testing;
+
+    class MustangEmulatorTest : public testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            emulator = std::make_shared<MustangEmulator>(model);
+            m = std::make_unique<Mustang>(model, emulator);
+        }
+
+        const DeviceModel model{"Mustang III/IV/V", DeviceModel::Category::MustangV1, 100, 4, 4};
+        std::shared_ptr<MustangEmulator> emulator;
+        std::unique_ptr<Mustang> m;
+        static constexpr amp_settings amp{amps::BRITISH_60S, 4, 8, 5, 9, 1,
+                                          cabinets::cabBSSMN, 5, 3, 4, 7, 4, 2, 6, 1,
+                                          true, 17};
+        static constexpr std::uint8_t modKnob{0x01};
+        static constexpr std::uint8_t dlyRevKnob{0x02};
+    };
+
+
+    TEST_F(MustangEmulatorTest, startAmpInitializesEmulator)
+    {
+        EXPECT_THAT(emulator->isInitialized(), IsFalse());
+        m->start_amp();
+        EXPECT_THAT(emulator->isInitialized(), IsTrue());
+    }
+
+    TEST_F(MustangEmulatorTest, startAmpReceivesPresetList)
+    {
+        const auto [signalChain, presets] = m->start_amp();
+
+        EXPECT_THAT(presets, SizeIs(100));
+        EXPECT_THAT(presets[0], StrEq("Preset 0"));
+        EXPECT_THAT(presets[99], StrEq("Preset 99"));
+        EXPECT_THAT(signalChain.name(), StrEq("Preset 0"));
+        EXPECT_THAT(signalChain.amp().amp_num, Eq(amps::FENDER_57_DELUXE));
+        EXPECT_THAT(signalChain.effects(), Each(Field(&fx_pedal_settings::effect_num, Eq(effects::EMPTY))));
+    }
+
+    TEST_F(MustangEmulatorTest, startAmpStopsAtEndOfStream)
+    {
+        m->start_amp();
+
+        constexpr std::size_t initResponses{2};
+        constexpr std::size_t presetPackets{100 * 2};
+        constexpr std::size_t statePackets{8};
+        constexpr std::size_t knobPresetPackets{4 * 3 + 4 * 4};
+        EXPECT_THAT(emulator->inTransfers(), Eq(initResponses + presetPackets + statePackets + knobPresetPackets));
+    }
+
+    TEST_F(MustangEmulatorTest, startAmpStopsAtEndOfStreamWithUnequalKnobPresets)
+    {
+        const DeviceModel unequal{"Mustang III/IV/V", DeviceModel::Category::MustangV1, 100, 5, 2};
+        auto unequalEmulator = std::make_shared<MustangEmulator>(unequal);
+        Mustang mustang{unequal, unequalEmulator};
+        mustang.start_amp();
+
+        constexpr std::size_t initResponses{2};
+        constexpr std::size_t presetPackets{100 * 2};
+        constexpr std::size_t statePackets{8};
+        constexpr std::size_t knobPresetPackets{5 * 3 + 2 * 4};
+        EXPECT_THAT(unequalEmulator->inTransfers(), Eq(initResponses + presetPackets + statePackets + knobPresetPackets));
+    }
+
+    TEST_F(MustangEmulatorTest, startAmpWithModelWithoutPresetCount)
+    {
+        const DeviceModel mini{"Mustang Mini", DeviceModel::Category::MustangV1, 0};
+        auto miniEmulator = std::make_shared<MustangEmulator>(mini);
+        Mustang mustang{mini, miniEmulator};
+
+        const auto [signalChain, presets] = mustang.start_amp();
+        EXPECT_THAT(presets, SizeIs(24));
+        EXPECT_THAT(signalChain.amp().amp_num, Eq(amps::FENDER_57_DELUXE));
+    }
+
+    TEST_F(MustangEmulatorTest, commandsAreIgnoredBeforeInitialization)
+    {
+        emulator->send(serializeLoadCommand().getBytes());
+        EXPECT_THAT(emulator->receive(packetRawTypeSize), SizeIs(0));
+    }
+
+    TEST_F(MustangEmulatorTest, setAmplifierUpdatesCurrentAmp)
+    {
+        m->start_amp();
+        m->set_amplifier(amp);
+        EXPECT_THAT(emulator->currentAmp(), AmpIs(amp));
+    }
+
+    TEST_F(MustangEmulatorTest, setEffectUpdatesCurrentEffects)
+    {
+        constexpr fx_pedal_settings effect{FxSlot{0x01}, effects::TRIANGLE_FLANGER, 10, 20, 30, 40, 50, 0};
+        m->start_amp();
+        m->set_effect(effect);
+
+        const auto current = emulator->currentEffects();
+        EXPECT_THAT(current[1].effect_num, Eq(effects::TRIANGLE_FLANGER));
+        EXPECT_THAT(current[1].knob1, Eq(10));
+        EXPECT_THAT(current[1].knob5, Eq(50));
+    }
+
+    TEST_F(MustangEmulatorTest, setEffectClearsEffect)
+    {
+        constexpr fx_pedal_settings effect{FxSlot{0x01}, effects::TRIANGLE_FLANGER, 10, 20, 30, 40, 50, 0};
+        m->start_amp();
+        m->set_effect(effect);
+        m->set_effect(fx_pedal_settings{FxSlot{0x01}, effects::TRIANGLE_FLANGER, 0, 0, 0, 0, 0, 0, false});
+
+        EXPECT_THAT(emulator->currentEffects()[1].effect_num, Eq(effects::EMPTY));
+    }
+
+    TEST_F(MustangEmulatorTest, saveOnAmpStoresBank)
+    {
+        m->start_amp();
+        m->set_amplifier(amp);
+        m->save_on_amp("abc", 3);
+
+        EXPECT_THAT(emulator->presetName(3), StrEq("abc"));
+        EXPECT_THAT(emulator->currentName(), StrEq("abc"));
+    }
+
+    TEST_F(MustangEmulatorTest, loadMemoryBankReturnsStoredBank)
+    {
+        m->start_amp();
+        m->set_amplifier(amp);
+        m->save_on_amp("abc", 5);
+        m->load_memory_bank(0);
+
+        const auto signalChain = m->load_memory_bank(5);
+        EXPECT_THAT(signalChain.name(), StrEq("abc"));
+        EXPECT_THAT(signalChain.amp(), AmpIs(amp));
+        EXPECT_THAT(emulator->currentAmp(), AmpIs(amp));
+    }
+
+    TEST_F(MustangEmulatorTest, populatingFromLoadedBankDoesNotWriteSettingsBack)
+    {
+        // Wired like the settings windows: every widget change is streamed
+        // and marks an edit, send() writes the pending edits
+        struct AmpWindow
+        {
+            Mustang& device;
+            EditTracker edits{};
+            amp_settings settings{};
+
+            void widgetChanged(const amp_settings& value)
+            {
+                settings = value;
+                edits.setChanged(true);
+
+                if (!edits.populating())
+                {
+                    device.set_amplifier(settings);
+                }
+            }
+
+            void load(const amp_settings& value)
+            {
+                edits.populate([this, &value]
+                               { widgetChanged(value); });
+            }
+
+            void send()
+            {
+                if (edits.takeChanges())
+                {
+                    device.set_amplifier(settings);
+                }
+            }
+        };
+
+        m->start_amp();
+        m->set_amplifier(amp);
+        m->save_on_amp("abc", 5);
+        AmpWindow window{*m};
+
+        const auto chain = m->load_memory_bank(5);
+        const auto outBefore = emulator->outTransfers();
+        window.load(chain.amp());
+        window.send();
+        EXPECT_THAT(emulator->outTransfers(), Eq(outBefore));
+
+        auto edited = chain.amp();
+        edited.gain = 0x33;
+        window.widgetChanged(edited);
+        window.send();
+        EXPECT_THAT(emulator->outTransfers(), Gt(outBefore));
+        EXPECT_THAT(emulator->currentAmp(), AmpIs(edited));
+    }
+
+    TEST_F(MustangEmulatorTest, startAmpFillsCachedState)
+    {
+        EXPECT_THAT(m->cachedState(), Eq(std::nullopt));
+        m->start_amp();
+
+        ASSERT_THAT(m->cachedState(), Ne(std::nullopt));
+        EXPECT_THAT(m->cachedState()->name(), StrEq("Preset 0"));
+        EXPECT_THAT(m->cachedState()->effects(), IsEmpty());
+    }
+
+    TEST_F(MustangEmulatorTest, loadMemoryBankFillsCachedState)
+    {
+        m->start_amp();
+        m->set_amplifier(amp);
+        m->save_on_amp("abc", 5);
+        m->load_memory_bank(0);
+        m->load_memory_bank(5);
+
+        EXPECT_THAT(m->cachedState()->name(), StrEq("abc"));
+        EXPECT_THAT(m->cachedState()->amp(), AmpIs(amp));
+    }
+
+    TEST_F(MustangEmulatorTest, applyUnchangedChainSendsNothing)
+    {
+        m->start_amp();
+        m->set_amplifier(amp);
+        const auto outBefore = emulator->outTransfers();
+
+        EXPECT_THAT(m->apply(*m->cachedState()), Eq(0));
+        EXPECT_THAT(emulator->outTransfers(), Eq(outBefore));
+    }
+
+    TEST_F(MustangEmulatorTest, applySendsOnlyChangedEffect)
+    {
+        constexpr fx_pedal_settings flanger{FxSlot{0x01}, effects::TRIANGLE_FLANGER, 10, 20, 30, 40, 50, 0};
+        constexpr fx_pedal_settings delay{FxSlot{0x02}, effects::MONO_DELAY, 1, 2, 3, 4, 5, 0};
+        m->start_amp();
+        m->set_amplifier(amp);
+        m->set_effect(flanger);
+        m->set_effect(delay);
+        const auto outBefore = emulator->outTransfers();
+
+        auto changedFlanger = flanger;
+        changedFlanger.knob3 = 99;
+        EXPECT_THAT(m->apply(SignalChain{"abc", amp, {changedFlanger, delay}}), Eq(1));
+        EXPECT_THAT(emulator->outTransfers() - outBefore, Eq(2));
+        EXPECT_THAT(emulator->currentEffects()[1].knob3, Eq(99));
+    }
+
+    TEST_F(MustangEmulatorTest, applySendsOnlyChangedAmp)
+    {
+        m->start_amp();
+        m->set_amplifier(amp);
+
+        auto changedAmp = amp;
+        changedAmp.gain = 99;
+        EXPECT_THAT(m->apply(SignalChain{"abc", changedAmp, {}}), Eq(1));
+        EXPECT_THAT(emulator->currentAmp(), AmpIs(changedAmp));
+    }
+
+    TEST_F(MustangEmulatorTest, applyClearsRemovedEffect)
+    {
+        constexpr fx_pedal_settings flanger{FxSlot{0x01}, effects::TRIANGLE_FLANGER, 10, 20, 30, 40, 50, 0};
+        m->start_amp();
+        m->set_amplifier(amp);
+        m->set_effect(flanger);
+
+        EXPECT_THAT(m->apply(SignalChain{"abc", amp, {}}), Eq(1));
+        EXPECT_THAT(emulator->currentEffects()[1].effect_num, Eq(effects::EMPTY));
+        EXPECT_THAT(m->cachedState()->effects(), IsEmpty());
+    }
+
+    TEST_F(MustangEmulatorTest, applyTracksCommittedBatch)
+    {
+        constexpr fx_pedal_settings flanger{FxSlot{0x01}, effects::TRIANGLE_FLANGER, 10, 20, 30, 40, 50, 0};
+        m->start_amp();
+        CommandBatch batch;
+        batch.set_amplifier(amp);
+        batch.set_effect(flanger);
+        m->commit(batch);
+
+        EXPECT_THAT(m->apply(SignalChain{"abc", amp, {flanger}}), Eq(0));
+    }
+
+    TEST_F(MustangEmulatorTest, startAmpReportsSavedState)
+    {
+        m->start_amp();
+        m->set_amplifier(amp);
+        m->save_on_amp("abc", 7);
+
+        const auto [signalChain, presets] = m->start_amp();
+        EXPECT_THAT(presets[7], StrEq("abc"));
+        EXPECT_THAT(signalChain.name(), StrEq("abc"));
+        EXPECT_THAT(signalChain.amp(), AmpIs(amp));
+    }
+
+    TEST_F(MustangEmulatorTest, startAmpKeepsUsbGain)
+    {
+        m->start_amp();
+        m->set_amplifier(amp);
+
+        const auto [signalChain, presets] = m->start_amp();
+        EXPECT_THAT(signalChain.amp().usb_gain, Eq(17));
+    }
+
+    TEST_F(MustangEmulatorTest, saveEffectsStoresKnobPreset)
+    {
+        const std::vector<fx_pedal_settings> modEffect{fx_pedal_settings{FxSlot{0x01}, effects::SINE_CHORUS, 1, 2, 3, 4, 5, 0}};
+        const std::vector<fx_pedal_settings> delayEffect{fx_pedal_settings{FxSlot{0x02}, effects::MONO_DELAY, 1, 2, 3, 4, 5, 0}};
+        m->start_amp();
+        m->save_effects(1, "mod fx", modEffect);
+        m->save_effects(2, "delay fx", delayEffect);
+
+        EXPECT_THAT(emulator->knobPresetName(modKnob, 1), StrEq("mod fx"));
+        EXPECT_THAT(emulator->knobPresetName(dlyRevKnob, 2), StrEq("delay fx"));
+    }
+
+    TEST_F(MustangEmulatorTest, v1IgnoresV2Amps)
+    {
+        constexpr amp_settings v2Amp{amps::BRITISH_WATTS, 4, 8, 5, 9, 1,
+                                     cabinets::cabBSSMN, 5, 3, 4, 7, 4, 2, 6, 1,
+                                     true, 17};
+        m->start_amp();
+        m->set_amplifier(v2Amp);
+        EXPECT_THAT(emulator->currentAmp().amp_num, Eq(amps::FENDER_57_DELUXE));
+    }
+
+    TEST_F(MustangEmulatorTest, v2AcceptsV2Amps)
+    {
+        constexpr amp_settings v2Amp{amps::BRITISH_WATTS, 4, 8, 5, 9, 1,
+                                     cabinets::cabBSSMN, 5, 3, 4, 7, 4, 2, 6, 1,
+                                     true, 17};
+        const DeviceModel v2Model{"Mustang I/II", DeviceModel::Category::MustangV2, 24};
+        auto v2Emulator = std::make_shared<MustangEmulator>(v2Model);
+        Mustang mustang{v2Model, v2Emulator};
+
+        mustang.start_amp();
+        mustang.set_amplifier(v2Amp);
+        EXPECT_THAT(v2Emulator->currentAmp(), AmpIs(v2Amp));
+    }
+
+    TEST_F(MustangEmulatorTest, transfersAreDelayedByLatency)
+    {
+        constexpr std::chrono::milliseconds latency{2};
+        MustangEmulator slowEmulator{model, latency};
+
+        const auto start = std::chrono::steady_clock::now();
+        slowEmulator.send(serializeLoadCommand().getBytes());
+        slowEmulator.receive(packetRawTypeSize);
+        EXPECT_THAT(std::chrono::steady_clock::now() - start, Ge(2 * latency));
+    }
+
+    TEST_F(MustangEmulatorTest, stopAmpClosesEmulator)
+    {
+        m->start_amp();
+        m->stop_amp();
+
+        EXPECT_THAT(emulator->isOpen(), IsFalse());
+        EXPECT_THROW(m->load_memory_bank(0), CommunicationException);
+    }
+}
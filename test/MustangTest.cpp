@@ -60,16 +60,50 @@ namespace plug::test
             return std::vector<std::uint8_t>{std::cbegin(c), std::cend(c)};
         }
 
+        [[nodiscard]] std::vector<std::uint8_t> streamPacketData(std::uint8_t dsp, std::uint8_t knob, std::uint8_t presetSlot) const
+        {
+            auto data = createEmptyPacketData();
+            data[0] = 0x1c;
+            data[1] = 0x01;
+            data[2] = dsp;
+            data[3] = knob;
+            data[4] = presetSlot;
+            return data;
+        }
+
+        [[nodiscard]] std::vector<std::uint8_t> confirmationData(std::uint8_t knob, std::uint8_t presetSlot) const
+        {
+            return streamPacketData(0x00, knob, presetSlot);
+        }
+
+        [[nodiscard]] std::vector<std::uint8_t> asStreamData(const PacketRawType& packet, std::uint8_t dsp) const
+        {
+            auto data = asBuffer(packet);
+            const auto header = streamPacketData(dsp, 0x00, 0x00);
+            std::copy(header.cbegin(), std::next(header.cbegin(), 5), data.begin());
+            return data;
+        }
+
+        void expectPresetNames(std::uint8_t first, std::uint8_t last)
+        {
+            for (std::uint8_t i = first; i < last; ++i)
+            {
+                EXPECT_CALL(*conn, receive(packetRawTypeSize))
+                    .WillOnce(Return(streamPacketData(0x04, 0x00, i)))
+                    .WillOnce(Return(confirmationData(0x00, i)));
+            }
+        }
+
 
         std::shared_ptr<mock::MockConnection> conn;
         std::unique_ptr<com::Mustang> m;
         const std::vector<std::uint8_t> noData{};
         const std::vector<std::uint8_t> ignoreData = std::vector<std::uint8_t>(packetRawTypeSize);
-        const std::vector<std::uint8_t> ignoreAmpData = []
-        { std::vector<std::uint8_t> d(packetRawTypeSize, 0x00); d[16] = 0x5e; return d; }();
+        const std::vector<std::uint8_t> ignoreAmpData = [this]
+        { auto d = streamPacketData(0x05, 0x00, 0x00); d[16] = 0x5e; return d; }();
         const PacketRawType loadCmd = serializeLoadCommand().getBytes();
         const PacketRawType applyCmd = serializeApplyCommand().getBytes();
-        static inline constexpr std::size_t numPresetPackets{200};
+        static inline constexpr std::uint8_t numPresets{100};
         static inline constexpr int slot{5};
     };
 
@@ -92,7 +126,7 @@ namespace plug::test
         EXPECT_CALL(*conn, sendImpl(BufferIs(loadCmd), loadCmd.size())).WillOnce(Return(loadCmd.size()));
 
         // Preset names data
-        EXPECT_CALL(*conn, receive(packetRawTypeSize)).Times(numPresetPackets).WillRepeatedly(Return(ignoreData));
+        expectPresetNames(0, numPresets);
 
         // Data
         EXPECT_CALL(*conn, receive(packetRawTypeSize))
@@ -134,10 +168,10 @@ namespace plug::test
         EXPECT_CALL(*conn, sendImpl(BufferIs(loadCmd), loadCmd.size())).WillOnce(Return(loadCmd.size()));
 
         // Preset names data
-        EXPECT_CALL(*conn, receive(packetRawTypeSize)).Times(numPresetPackets).WillRepeatedly(Return(ignoreData));
+        expectPresetNames(0, numPresets);
 
         const std::string actualName{"abc"};
-        const auto nameData = asBuffer(serializeName(0, actualName).getBytes());
+        const auto nameData = asStreamData(serializeName(0, actualName).getBytes(), 0x04);
 
         // Data
         EXPECT_CALL(*conn, receive(packetRawTypeSize))
@@ -162,8 +196,8 @@ namespace plug::test
         constexpr amp_settings amp{amps::BRITISH_60S, 4, 8, 5, 9, 1,
                                    cabinets::cabBSSMN, 5, 3, 4, 7, 4, 2, 6, 1,
                                    true, 17};
-        const auto recvData = asBuffer(serializeAmpSettings(amp).getBytes());
-        const auto extendedData = asBuffer(serializeAmpSettingsUsbGain(amp).getBytes());
+        const auto recvData = asStreamData(serializeAmpSettings(amp).getBytes(), 0x05);
+        const auto extendedData = asStreamData(serializeAmpSettingsUsbGain(amp).getBytes(), 0x0a);
         const auto [initPacket1, initPacket2] = serializeInitCommand();
         const auto initCmd1 = initPacket1.getBytes();
         const auto initCmd2 = initPacket2.getBytes();
@@ -181,7 +215,7 @@ namespace plug::test
         EXPECT_CALL(*conn, sendImpl(BufferIs(loadCmd), loadCmd.size())).WillOnce(Return(loadCmd.size()));
 
         // Preset names data
-        EXPECT_CALL(*conn, receive(packetRawTypeSize)).Times(numPresetPackets).WillRepeatedly(Return(ignoreData));
+        expectPresetNames(0, numPresets);
 
         // Data
         EXPECT_CALL(*conn, receive(packetRawTypeSize))
@@ -207,10 +241,10 @@ namespace plug::test
         constexpr fx_pedal_settings e1{FxSlot{0x01}, effects::TRIANGLE_CHORUS, 0, 0, 0, 1, 1, 1};
         constexpr fx_pedal_settings e2{FxSlot{0x02}, effects::EMPTY, 0, 0, 0, 0, 0, 0};
         constexpr fx_pedal_settings e3{FxSlot{0x03}, effects::TAPE_DELAY, 1, 2, 3, 4, 5, 6};
-        const auto recvData0 = asBuffer(serializeEffectSettings(e0).getBytes());
-        const auto recvData1 = asBuffer(serializeEffectSettings(e1).getBytes());
-        const auto recvData2 = asBuffer(serializeEffectSettings(e2).getBytes());
-        const auto recvData3 = asBuffer(serializeEffectSettings(e3).getBytes());
+        const auto recvData0 = asStreamData(serializeEffectSettings(e0).getBytes(), 0x06);
+        const auto recvData1 = asStreamData(serializeEffectSettings(e1).getBytes(), 0x07);
+        const auto recvData2 = asStreamData(serializeEffectSettings(e2).getBytes(), 0x08);
+        const auto recvData3 = asStreamData(serializeEffectSettings(e3).getBytes(), 0x09);
         const auto [initPacket1, initPacket2] = serializeInitCommand();
         const auto initCmd1 = initPacket1.getBytes();
         const auto initCmd2 = initPacket2.getBytes();
@@ -229,7 +263,7 @@ namespace plug::test
         EXPECT_CALL(*conn, sendImpl(BufferIs(loadCmd), loadCmd.size())).WillOnce(Return(loadCmd.size()));
 
         // Preset names data
-        EXPECT_CALL(*conn, receive(packetRawTypeSize)).Times(numPresetPackets).WillRepeatedly(Return(ignoreData));
+        expectPresetNames(0, numPresets);
 
         // Data
         EXPECT_CALL(*conn, receive(packetRawTypeSize))
@@ -255,9 +289,9 @@ namespace plug::test
         const auto [initPacket1, initPacket2] = serializeInitCommand();
         const auto initCmd1 = initPacket1.getBytes();
         const auto initCmd2 = initPacket2.getBytes();
-        const auto recvData0 = asBuffer(serializeName(0, "abc").getBytes());
-        const auto recvData1 = asBuffer(serializeName(0, "def").getBytes());
-        const auto recvData2 = asBuffer(serializeName(0, "ghi").getBytes());
+        const auto recvData0 = asStreamData(serializeName(0, "abc").getBytes(), 0x04);
+        const auto recvData1 = asStreamData(serializeName(0, "def").getBytes(), 0x04);
+        const auto recvData2 = asStreamData(serializeName(0, "ghi").getBytes(), 0x04);
 
 
         InSequence s;
@@ -275,12 +309,12 @@ namespace plug::test
         // Preset names data
         EXPECT_CALL(*conn, receive(packetRawTypeSize))
             .WillOnce(Return(recvData0))
-            .WillOnce(Return(ignoreData))
+            .WillOnce(Return(confirmationData(0x00, 0)))
             .WillOnce(Return(recvData1))
-            .WillOnce(Return(ignoreData))
+            .WillOnce(Return(confirmationData(0x00, 1)))
             .WillOnce(Return(recvData2))
-            .WillOnce(Return(ignoreData));
-        EXPECT_CALL(*conn, receive(packetRawTypeSize)).Times(numPresetPackets - 6).WillRepeatedly(Return(ignoreData));
+            .WillOnce(Return(confirmationData(0x00, 2)));
+        expectPresetNames(3, numPresets);
 
         // Data
         EXPECT_CALL(*conn, receive(packetRawTypeSize))
@@ -296,7 +330,7 @@ namespace plug::test
 
         const auto [signalChain, presetList] = m->start_amp();
 
-        EXPECT_THAT(presetList.size(), Eq(numPresetPackets / 2));
+        EXPECT_THAT(presetList.size(), Eq(numPresets));
         EXPECT_THAT(presetList[0], StrEq("abc"));
         EXPECT_THAT(presetList[1], StrEq("def"));
         EXPECT_THAT(presetList[2], StrEq("ghi"));
@@ -304,11 +338,46 @@ namespace plug::test
         static_cast<void>(signalChain);
     }
 
-    TEST_F(MustangTest, startUsesFullInitialTransmissionSizeIfOverThreshold)
+    TEST_F(MustangTest, startReceivesPresetNamesIndependentOfDeviceModel)
+    {
+        m = std::make_unique<com::Mustang>(DeviceModel{"Test Device", DeviceModel::Category::MustangV2, 0}, conn);
+        constexpr std::uint8_t numReceivedPresets{24};
+
+        InSequence s;
+        EXPECT_CALL(*conn, isOpen()).WillOnce(Return(true));
+
+        // Init commands
+        EXPECT_CALL(*conn, sendImpl(_, _)).WillOnce(Return(packetRawTypeSize));
+        EXPECT_CALL(*conn, receive(packetRawTypeSize)).WillOnce(Return(ignoreData));
+        EXPECT_CALL(*conn, sendImpl(_, _)).WillOnce(Return(packetRawTypeSize));
+        EXPECT_CALL(*conn, receive(packetRawTypeSize)).WillOnce(Return(ignoreData));
+
+        // Load cmd
+        EXPECT_CALL(*conn, sendImpl(BufferIs(loadCmd), loadCmd.size())).WillOnce(Return(loadCmd.size()));
+
+        // Preset names data
+        expectPresetNames(0, numReceivedPresets);
+
+        // Data
+        EXPECT_CALL(*conn, receive(packetRawTypeSize))
+            .WillOnce(Return(streamPacketData(0x04, 0x00, 0x00)))
+            .WillOnce(Return(ignoreAmpData))
+            .WillOnce(Return(noData));
+
+
+        const auto [signalChain, presetList] = m->start_amp();
+        EXPECT_THAT(presetList.size(), Eq(numReceivedPresets));
+        EXPECT_THAT(signalChain.amp().amp_num, Eq(amps::BRITISH_80S));
+    }
+
+    TEST_F(MustangTest, startStopsReceivingAtEndOfStream)
     {
+        m = std::make_unique<com::Mustang>(DeviceModel{"Test Device", DeviceModel::Category::MustangV1, 100, 2, 2}, conn);
         const auto [initPacket1, initPacket2] = serializeInitCommand();
         const auto initCmd1 = initPacket1.getBytes();
         const auto initCmd2 = initPacket2.getBytes();
+        constexpr std::uint8_t mod{0x01};
+        constexpr std::uint8_t dlyRev{0x02};
 
         InSequence s;
         EXPECT_CALL(*conn, isOpen()).WillOnce(Return(true));
@@ -323,21 +392,91 @@ namespace plug::test
         EXPECT_CALL(*conn, sendImpl(BufferIs(loadCmd), loadCmd.size())).WillOnce(Return(loadCmd.size()));
 
         // Preset names data
-        EXPECT_CALL(*conn, receive(packetRawTypeSize)).Times(numPresetPackets).WillRepeatedly(Return(ignoreData));
+        expectPresetNames(0, numPresets);
 
         // Data
         EXPECT_CALL(*conn, receive(packetRawTypeSize))
-            .WillOnce(Return(ignoreData))
+            .WillOnce(Return(streamPacketData(0x04, 0x00, 0x00)))
             .WillOnce(Return(ignoreAmpData))
             .WillOnce(Return(ignoreData))
             .WillOnce(Return(ignoreData))
             .WillOnce(Return(ignoreData))
             .WillOnce(Return(ignoreData))
             .WillOnce(Return(ignoreData))
-            .WillOnce(Return(noData));
+            .WillOnce(Return(confirmationData(0x00, 0x00)));
+
+        // Mod knob presets
+        EXPECT_CALL(*conn, receive(packetRawTypeSize))
+            .WillOnce(Return(streamPacketData(0x04, mod, 0x00)))
+            .WillOnce(Return(streamPacketData(0x07, mod, 0x00)))
+            .WillOnce(Return(confirmationData(mod, 0x00)))
+            .WillOnce(Return(streamPacketData(0x04, mod, 0x01)))
+            .WillOnce(Return(streamPacketData(0x07, mod, 0x01)))
+            .WillOnce(Return(confirmationData(mod, 0x01)));
+
+        // Dly/Rev knob presets
+        EXPECT_CALL(*conn, receive(packetRawTypeSize))
+            .WillOnce(Return(streamPacketData(0x04, dlyRev, 0x00)))
+            .WillOnce(Return(streamPacketData(0x08, dlyRev, 0x00)))
+            .WillOnce(Return(streamPacketData(0x09, dlyRev, 0x00)))
+            .WillOnce(Return(confirmationData(dlyRev, 0x00)))
+            .WillOnce(Return(streamPacketData(0x04, dlyRev, 0x01)))
+            .WillOnce(Return(streamPacketData(0x08, dlyRev, 0x01)))
+            .WillOnce(Return(streamPacketData(0x09, dlyRev, 0x01)))
+            .WillOnce(Return(confirmationData(dlyRev, 0x01)));
 
 
-        m->start_amp();
+        const auto [signalChain, presetList] = m->start_amp();
+        EXPECT_THAT(presetList.size(), Eq(numPresets));
+        EXPECT_THAT(signalChain.amp().amp_num, Eq(amps::BRITISH_80S));
+    }
+
+    TEST_F(MustangTest, startReportsDataWhileReceiving)
+    {
+        m = std::make_unique<com::Mustang>(DeviceModel{"Test Device", DeviceModel::Category::MustangV1, 100, 1, 1}, conn);
+        constexpr std::uint8_t mod{0x01};
+        constexpr std::uint8_t dlyRev{0x02};
+        std::vector<std::string> reported;
+        const StartObserver observer{[&reported](std::size_t index, const std::string& name)
+                                     { reported.push_back(std::to_string(index) + ":" + name); },
+                                     [&reported](const SignalChain& signalChain)
+                                     { reported.push_back("state:" + signalChain.name()); }};
+
+        InSequence s;
+        EXPECT_CALL(*conn, isOpen()).WillOnce(Return(true));
+
+        // Init commands
+        EXPECT_CALL(*conn, sendImpl(_, _)).WillOnce(Return(packetRawTypeSize));
+        EXPECT_CALL(*conn, receive(packetRawTypeSize)).WillOnce(Return(ignoreData));
+        EXPECT_CALL(*conn, sendImpl(_, _)).WillOnce(Return(packetRawTypeSize));
+        EXPECT_CALL(*conn, receive(packetRawTypeSize)).WillOnce(Return(ignoreData));
+
+        // Load cmd
+        EXPECT_CALL(*conn, sendImpl(BufferIs(loadCmd), loadCmd.size())).WillOnce(Return(loadCmd.size()));
+
+        // Preset names data
+        EXPECT_CALL(*conn, receive(packetRawTypeSize))
+            .WillOnce(Return(asStreamData(serializeName(0, "abc").getBytes(), 0x04)))
+            .WillOnce(Return(confirmationData(0x00, 0)))
+            .WillOnce(Return(asStreamData(serializeName(1, "def").getBytes(), 0x04)))
+            .WillOnce(Return(confirmationData(0x00, 1)));
+
+        // Data
+        EXPECT_CALL(*conn, receive(packetRawTypeSize))
+            .WillOnce(Return(asStreamData(serializeName(1, "def").getBytes(), 0x04)))
+            .WillOnce(Return(ignoreAmpData))
+            .WillOnce(Return(confirmationData(0x00, 0x00)))
+            .WillOnce(DoAll([&reported]
+                            { EXPECT_THAT(reported, ElementsAre("0:abc", "1:def", "state:def")); },
+                            Return(streamPacketData(0x04, mod, 0x00))))
+            .WillOnce(Return(confirmationData(mod, 0x00)))
+            .WillOnce(Return(streamPacketData(0x04, dlyRev, 0x00)))
+            .WillOnce(Return(confirmationData(dlyRev, 0x00)));
+
+
+        const auto [signalChain, presetList] = m->start_amp(observer);
+        EXPECT_THAT(presetList, ElementsAre("abc", "def"));
+        EXPECT_THAT(reported.size(), Eq(3));
     }
 
     TEST_F(MustangTest, stopAmpClosesConnection)
@@ -369,9 +508,30 @@ namespace plug::test
         m->load_memory_bank(slot);
     }
 
+    TEST_F(MustangTest, loadMemoryBankStopsReceivingAtConfirmation)
+    {
+        InSequence s;
+        // Load cmd
+        EXPECT_CALL(*conn, sendImpl(_, _)).WillOnce(Return(packetRawTypeSize));
+
+        // Data
+        EXPECT_CALL(*conn, receive(packetRawTypeSize))
+            .WillOnce(Return(streamPacketData(0x04, 0x00, slot)))
+            .WillOnce(Return(ignoreAmpData))
+            .WillOnce(Return(ignoreData))
+            .WillOnce(Return(ignoreData))
+            .WillOnce(Return(ignoreData))
+            .WillOnce(Return(ignoreData))
+            .WillOnce(Return(ignoreData))
+            .WillOnce(Return(confirmationData(0x00, slot)));
+
+        const auto signalChain = m->load_memory_bank(slot);
+        EXPECT_THAT(signalChain.amp().amp_num, Eq(amps::BRITISH_80S));
+    }
+
     TEST_F(MustangTest, loadMemoryBankReceivesName)
     {
-        const auto recvData = asBuffer(serializeName(0, "abc").getBytes());
+        const auto recvData = asStreamData(serializeName(0, "abc").getBytes(), 0x04);
 
         InSequence s;
         // Load cmd
@@ -399,8 +559,8 @@ namespace plug::test
                                   cabinets::cab4x12M, 0, 9, 10, 11,
                                   0, 0x80, 13, 1, false, 0xab};
 
-        const auto recvData = asBuffer(serializeAmpSettings(as).getBytes());
-        const auto extendedData = asBuffer(serializeAmpSettingsUsbGain(as).getBytes());
+        const auto recvData = asStreamData(serializeAmpSettings(as).getBytes(), 0x05);
+        const auto extendedData = asStreamData(serializeAmpSettingsUsbGain(as).getBytes(), 0x0a);
 
         InSequence s;
         // Load cmd
@@ -428,10 +588,10 @@ namespace plug::test
         constexpr fx_pedal_settings e1{FxSlot{0x01}, effects::TRIANGLE_CHORUS, 0, 0, 0, 1, 1, 0};
         constexpr fx_pedal_settings e2{FxSlot{0x02}, effects::EMPTY, 0, 0, 0, 0, 0, 0};
         constexpr fx_pedal_settings e3{FxSlot{0x03}, effects::TAPE_DELAY, 1, 2, 3, 4, 5, 6};
-        const auto recvData0 = asBuffer(serializeEffectSettings(e0).getBytes());
-        const auto recvData1 = asBuffer(serializeEffectSettings(e1).getBytes());
-        const auto recvData2 = asBuffer(serializeEffectSettings(e2).getBytes());
-        const auto recvData3 = asBuffer(serializeEffectSettings(e3).getBytes());
+        const auto recvData0 = asStreamData(serializeEffectSettings(e0).getBytes(), 0x06);
+        const auto recvData1 = asStreamData(serializeEffectSettings(e1).getBytes(), 0x07);
+        const auto recvData2 = asStreamData(serializeEffectSettings(e2).getBytes(), 0x08);
+        const auto recvData3 = asStreamData(serializeEffectSettings(e3).getBytes(), 0x09);
 
 
         InSequence s;
@@ -550,6 +710,121 @@ namespace plug::test
         m->set_effect(settings);
     }
 
+    TEST_F(MustangTest, commitSendsBatchWithSingleApply)
+    {
+        constexpr amp_settings amp{amps::BRITISH_70S, 8, 9, 1, 2, 3,
+                                   cabinets::cab4x12G, 3, 5, 3, 2, 1,
+                                   4, 1, 5, true, 4};
+        constexpr fx_pedal_settings effect{FxSlot{3}, effects::OVERDRIVE, 8, 7, 6, 5, 4, 3};
+        CommandBatch batch;
+        batch.set_amplifier(amp);
+        batch.set_effect(effect);
+
+
+        InSequence s;
+        for (const auto& data : batch.packets())
+        {
+            EXPECT_CALL(*conn, sendImpl(BufferIs(data), data.size())).WillOnce(Return(data.size()));
+            EXPECT_CALL(*conn, receive(packetRawTypeSize)).WillOnce(Return(ignoreData));
+        }
+
+        // Apply command
+        EXPECT_CALL(*conn, sendImpl(BufferIs(applyCmd), applyCmd.size())).WillOnce(Return(applyCmd.size()));
+        EXPECT_CALL(*conn, receive(packetRawTypeSize)).WillOnce(Return(ignoreData));
+
+        m->commit(batch);
+    }
+
+    TEST_F(MustangTest, commitWithSignalChainSetsCachedState)
+    {
+        constexpr amp_settings amp{amps::BRITISH_70S, 8, 9, 1, 2, 3,
+                                   cabinets::cab4x12G, 3, 5, 3, 2, 1,
+                                   4, 1, 5, true, 4};
+        constexpr fx_pedal_settings effect{FxSlot{3}, effects::MONO_DELAY, 8, 7, 6, 5, 4, 3};
+        const SignalChain chain{"abc", amp, {effect}};
+        CommandBatch batch;
+        batch.set_signal_chain(chain);
+
+        EXPECT_CALL(*conn, sendImpl(_, _)).Times(static_cast<int>(batch.size() + 1)).WillRepeatedly(Return(packetRawTypeSize));
+        EXPECT_CALL(*conn, receive(packetRawTypeSize)).WillRepeatedly(Return(ignoreData));
+
+        m->commit(batch);
+        EXPECT_THAT(m->apply(chain), Eq(0));
+    }
+
+    TEST_F(MustangTest, commitAppliesWritesAfterSignalChainToCachedState)
+    {
+        constexpr amp_settings amp{amps::BRITISH_70S, 8, 9, 1, 2, 3,
+                                   cabinets::cab4x12G, 3, 5, 3, 2, 1,
+                                   4, 1, 5, true, 4};
+        constexpr fx_pedal_settings effect{FxSlot{3}, effects::MONO_DELAY, 8, 7, 6, 5, 4, 3};
+        constexpr fx_pedal_settings laterEffect{FxSlot{1}, effects::SINE_CHORUS, 1, 2, 3, 4, 5, 0};
+        CommandBatch batch;
+        batch.set_signal_chain(SignalChain{"abc", amp, {effect}});
+        batch.set_effect(laterEffect);
+
+        EXPECT_CALL(*conn, sendImpl(_, _)).Times(static_cast<int>(batch.size() + 1)).WillRepeatedly(Return(packetRawTypeSize));
+        EXPECT_CALL(*conn, receive(packetRawTypeSize)).WillRepeatedly(Return(ignoreData));
+
+        m->commit(batch);
+        EXPECT_THAT(m->cachedState()->effects(), ElementsAre(EffectIs(laterEffect), EffectIs(effect)));
+    }
+
+    TEST_F(MustangTest, commitDoesNothingOnEmptyBatch)
+    {
+        EXPECT_CALL(*conn, sendImpl(_, _)).Times(0);
+        m->commit(CommandBatch{});
+    }
+
+    TEST_F(MustangTest, applyWithoutCachedStateWritesEverything)
+    {
+        constexpr amp_settings amp{amps::BRITISH_70S, 8, 9, 1, 2, 3,
+                                   cabinets::cab4x12G, 3, 5, 3, 2, 1,
+                                   4, 1, 5, true, 4};
+        constexpr fx_pedal_settings effect{FxSlot{3}, effects::MONO_DELAY, 8, 7, 6, 5, 4, 3};
+        const auto dataAmp = serializeAmpSettings(amp).getBytes();
+        const auto dataUsbGain = serializeAmpSettingsUsbGain(amp).getBytes();
+        const auto dataEffect = serializeEffectSettings(effect).getBytes();
+        const auto clear = [](effects e)
+        { return serializeClearEffectSettings(fx_pedal_settings{FxSlot{0}, e, 0, 0, 0, 0, 0, 0, false}).getBytes(); };
+        const std::array<PacketRawType, 6> expected{{dataAmp, dataUsbGain,
+                                                     clear(effects::OVERDRIVE), clear(effects::SINE_CHORUS),
+                                                     dataEffect, clear(effects::SMALL_HALL_REVERB)}};
+
+
+        InSequence s;
+        for (const auto& data : expected)
+        {
+            EXPECT_CALL(*conn, sendImpl(BufferIs(data), data.size())).WillOnce(Return(data.size()));
+            EXPECT_CALL(*conn, receive(packetRawTypeSize)).WillOnce(Return(ignoreData));
+        }
+
+        // Apply command
+        EXPECT_CALL(*conn, sendImpl(BufferIs(applyCmd), applyCmd.size())).WillOnce(Return(applyCmd.size()));
+        EXPECT_CALL(*conn, receive(packetRawTypeSize)).WillOnce(Return(ignoreData));
+
+        EXPECT_THAT(m->apply(SignalChain{"abc", amp, {effect}}), Eq(6));
+        EXPECT_THAT(m->cachedState()->effects(), ElementsAre(EffectIs(effect)));
+    }
+
+    TEST_F(MustangTest, trackUpdatesCachedStateWithChangesOnAmp)
+    {
+        constexpr amp_settings amp{amps::BRITISH_70S, 8, 9, 1, 2, 3,
+                                   cabinets::cab4x12G, 3, 5, 3, 2, 1,
+                                   4, 1, 5, true, 4};
+        constexpr fx_pedal_settings effect{FxSlot{3}, effects::MONO_DELAY, 8, 7, 6, 5, 4, 3, true};
+        auto changedAmp = amp;
+        changedAmp.gain = 0x44;
+
+        m->track(event::PresetSelected{3, SignalChain{"abc", amp, {effect}}});
+        m->track(event::AmpChanged{changedAmp});
+
+        ASSERT_THAT(m->cachedState().has_value(), IsTrue());
+        EXPECT_THAT(m->cachedState()->name(), StrEq("abc"));
+        EXPECT_THAT(m->cachedState()->amp().gain, Eq(0x44));
+        EXPECT_THAT(m->cachedState()->effects(), ElementsAre(EffectIs(effect)));
+    }
+
     TEST_F(MustangTest, saveEffectsSendsValues)
     {
         const std::vector<fx_pedal_settings> settings{fx_pedal_settings{FxSlot{1}, effects::MONO_DELAY, 0, 1, 2, 3, 4, 5},
@@ -0,0 +1,200 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "com/MustangUpdater.h"
+#include "mocks/LibUsbMocks.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <thread>
+#include <vector>
+#include <libusb-1.0/libusb.h>
+#include <gmock/gmock.h>
+
+namespace plug::test
+{
+    using namespace plug::com;
+    using namespace testing;
+    using namespace std::chrono_literals;
+
+    namespace
+    {
+        // Answers every packet after a USB round trip
+        class FakeUpdateDevice : public Connection
+        {
+        public:
+            explicit FakeUpdateDevice(std::chrono::microseconds roundTrip = 0us)
+                : roundTrip_(roundTrip)
+            {
+            }
+
+            void close() override
+            {
+            }
+
+            bool isOpen() const override
+            {
+                return true;
+            }
+
+            std::vector<std::uint8_t> receive(std::size_t recvSize) override
+            {
+                std::this_thread::sleep_for(roundTrip_);
+                log.push_back('r');
+                return std::vector<std::uint8_t>(recvSize, 0x00);
+            }
+
+            std::string name() const override
+            {
+                return "update mode";
+            }
+
+            std::vector<std::vector<std::uint8_t>> sent;
+            std::string log;
+
+        private:
+            std::size_t sendImpl(const std::uint8_t* data, std::size_t size) override
+            {
+                sent.emplace_back(data, std::next(data, size));
+                log.push_back('s');
+                return size;
+            }
+
+            const std::chrono::microseconds roundTrip_;
+        };
+
+        std::vector<std::uint8_t> createImage(std::size_t payloadSize)
+        {
+            std::vector<std::uint8_t> image(0x110 + payloadSize, 0x00);
+            const std::string date{"Mar 12 2013"};
+            std::copy(date.cbegin(), date.cend(), std::next(image.begin(), 0x1a));
+            std::iota(std::next(image.begin(), 0x110), image.end(), std::uint8_t{0x01});
+            return image;
+        }
+
+        std::filesystem::path writeFile(const std::vector<std::uint8_t>& data)
+        {
+            const auto filename = std::filesystem::temp_directory_path() / "plug-test-firmware.upd";
+            std::ofstream file{filename, std::ios::binary};
+            file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+            return filename;
+        }
+    }
+
+
+    class MustangUpdaterTest : public testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            usbmock = mock::resetUsbMock();
+        }
+
+        void TearDown() override
+        {
+            mock::clearUsbMock();
+        }
+
+        mock::UsbMock* usbmock{nullptr};
+    };
+
+
+    TEST_F(MustangUpdaterTest, sendFirmwareSendsPacketsOfImage)
+    {
+        const FirmwareImage image{createImage(100)};
+        FakeUpdateDevice device;
+
+        sendFirmware(device, image);
+
+        ASSERT_THAT(device.sent, SizeIs(image.packets().size()));
+        EXPECT_TRUE(std::equal(device.sent.cbegin(), device.sent.cend(), image.packets().cbegin(), [](const auto& sent, const auto& expected)
+                               { return std::equal(sent.cbegin(), sent.cend(), expected.cbegin(), expected.cend()); }));
+    }
+
+    TEST_F(MustangUpdaterTest, sendFirmwareWaitsForAnswerBeforeNextPacket)
+    {
+        FakeUpdateDevice device;
+
+        sendFirmware(device, FirmwareImage{createImage(200)});
+
+        EXPECT_THAT(device.log, StrEq("srsrsrsrsrsr"));
+    }
+
+    TEST_F(MustangUpdaterTest, sendFirmwareReportsProgressPerPacket)
+    {
+        FakeUpdateDevice device;
+        std::vector<UpdateProgress> reported;
+
+        sendFirmware(device, FirmwareImage{createImage(100)}, [&reported](const UpdateProgress& progress)
+                     { reported.push_back(progress); });
+
+        ASSERT_THAT(reported, SizeIs(4));
+        EXPECT_THAT(reported[0].packetsSent, Eq(1));
+        EXPECT_THAT(reported[0].packetsTotal, Eq(4));
+        EXPECT_THAT(reported[3].packetsSent, Eq(4));
+        EXPECT_THAT(reported[3].packetsTotal, Eq(4));
+        EXPECT_THAT(reported[3].bytesPerSecond, Gt(0.0));
+    }
+
+    TEST_F(MustangUpdaterTest, sendFirmwareTimeScalesWithRoundTrips)
+    {
+        constexpr std::size_t chunks{50};
+        constexpr auto roundTrip = 1ms;
+        FakeUpdateDevice device{roundTrip};
+
+        const auto start = std::chrono::steady_clock::now();
+        sendFirmware(device, FirmwareImage{createImage(chunks * 56 - 1)});
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+
+        const auto exchanges = chunks + 2;
+        EXPECT_THAT(device.sent, SizeIs(exchanges));
+        EXPECT_THAT(elapsed, Ge(exchanges * roundTrip));
+        EXPECT_THAT(elapsed, Lt(exchanges * 10ms)); // Former fixed delay per packet
+    }
+
+    TEST_F(MustangUpdaterTest, updateFirmwareFailsOnUnreadableFile)
+    {
+        EXPECT_CALL(*usbmock, init(_)).Times(0);
+
+        EXPECT_THAT(updateFirmware("/nonexistent/firmware.upd"), Eq(updateErrorFile));
+    }
+
+    TEST_F(MustangUpdaterTest, updateFirmwareFailsOnInvalidImageBeforeDeviceIsTouched)
+    {
+        const auto filename = writeFile(std::vector<std::uint8_t>(0x100, 0x00));
+        EXPECT_CALL(*usbmock, init(_)).Times(0);
+
+        EXPECT_THAT(updateFirmware(filename.string()), Eq(updateErrorImage));
+        std::filesystem::remove(filename);
+    }
+
+    TEST_F(MustangUpdaterTest, updateFirmwareFailsIfNoDeviceInUpdateMode)
+    {
+        const auto filename = writeFile(createImage(100));
+        EXPECT_CALL(*usbmock, init(_)).WillOnce(Return(LIBUSB_SUCCESS));
+        EXPECT_CALL(*usbmock, get_device_list(_, _)).WillOnce(Return(0));
+        EXPECT_CALL(*usbmock, free_device_list(_, _));
+        EXPECT_CALL(*usbmock, exit(_));
+
+        EXPECT_THAT(updateFirmware(filename.string()), Eq(updateErrorNoDevice));
+        std::filesystem::remove(filename);
+    }
+}
@@ -0,0 +1,72 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "com/PacketArena.h"
+#include <gmock/gmock.h>
+
+namespace plug::test
+{
+    using namespace plug::com;
+    using namespace testing;
+
+    class PacketArenaTest : public testing::Test
+    {
+    };
+
+
+    TEST_F(PacketArenaTest, ctorReservesCapacity)
+    {
+        const PacketArena arena{208};
+        EXPECT_THAT(arena.size(), Eq(0));
+        EXPECT_THAT(arena.capacity(), Ge(208));
+    }
+
+    TEST_F(PacketArenaTest, allocateReturnsZeroedPacket)
+    {
+        PacketArena arena{1};
+        const auto& packet = arena.allocate();
+        EXPECT_THAT(packet, Each(Eq(0x00)));
+        EXPECT_THAT(arena.size(), Eq(1));
+    }
+
+    TEST_F(PacketArenaTest, allocateWithinCapacityKeepsPacketsInPlace)
+    {
+        PacketArena arena{3};
+        auto& first = arena.allocate();
+        first[0] = 0xab;
+        arena.allocate();
+        arena.allocate();
+
+        EXPECT_THAT(&arena[0], Eq(&first));
+        EXPECT_THAT(arena[0][0], Eq(0xab));
+        EXPECT_THAT(arena.capacity(), Eq(3));
+    }
+
+    TEST_F(PacketArenaTest, resetKeepsCapacity)
+    {
+        PacketArena arena{4};
+        arena.allocate();
+        arena.allocate();
+        arena.reset();
+
+        EXPECT_THAT(arena.size(), Eq(0));
+        EXPECT_THAT(arena.capacity(), Ge(4));
+        EXPECT_THAT(arena.allocate(), Each(Eq(0x00)));
+    }
+}
@@ -84,22 +84,10 @@ namespace plug::test
             return {{packet, emptyEffectPayload, emptyEffectPayload, emptyEffectPayload}};
         };
 
-        [[nodiscard]] Packet<NamePayload> presetNameEmptyPacket() const
+        static constexpr bool zeroFrom(const PacketRawType& packet, std::size_t first)
         {
-            NamePayload payload{};
-            Packet<NamePayload> packet{};
-            packet.setPayload(payload);
-            return packet;
-        }
-
-        [[nodiscard]] Packet<NamePayload> presetNamePacket(std::string_view name) const
-        {
-            NamePayload payload{};
-            payload.setName(name);
-
-            Packet<NamePayload> packet{};
-            packet.setPayload(payload);
-            return packet;
+            return std::all_of(std::next(packet.cbegin(), static_cast<std::ptrdiff_t>(first)), packet.cend(), [](auto b)
+                               { return b == 0x00; });
         }
 
         const Packet<EffectPayload> emptyEffectPayload{};
@@ -167,6 +155,38 @@ namespace plug::test
         EXPECT_THAT(packet.getBytes(), ContainerEq(expected));
     }
 
+    TEST_F(PacketSerializerTest, commandPacketsMatchDocumentedLayout)
+    {
+        // Init: "0xc3" on the first position, then "0x1a" on the zeroth; the second packet uses
+        // 0xc1 instead of the documented 0x03, which works on v1 and v2 devices
+        static_assert(initCommandPackets[0][0] == 0x00 && initCommandPackets[0][1] == 0xc3 && zeroFrom(initCommandPackets[0], 2));
+        static_assert(initCommandPackets[1][0] == 0x1a && initCommandPackets[1][1] == 0xc1 && zeroFrom(initCommandPackets[1], 2));
+
+        // Load: "0xff" on the zeroth and "0xc1" on the first position
+        static_assert(loadCommandPacket[0] == 0xff && loadCommandPacket[1] == 0xc1 && zeroFrom(loadCommandPacket, 2));
+
+        // Apply: zeroth byte "0x1c", first "0x03" and all others "0x00"
+        static_assert(applyCommandPacket[0] == 0x1c && applyCommandPacket[1] == 0x03 && zeroFrom(applyCommandPacket, 2));
+
+        // Choosing memory bank: 1c 01 01 00 SLT 00 01 00 ...
+        static_assert(loadSlotCommandPackets.size() == 100);
+        static_assert(std::all_of(loadSlotCommandPackets.cbegin(), loadSlotCommandPackets.cend(), [](const auto& packet)
+                                  {
+                                      const auto slot = static_cast<std::size_t>(std::distance(loadSlotCommandPackets.data(), &packet));
+                                      return packet[0] == 0x1c && packet[1] == 0x01 && packet[2] == 0x01 && packet[3] == 0x00
+                                          && packet[v1::SAVE_SLOT] == slot && packet[5] == 0x00 && packet[6] == 0x01
+                                          && zeroFrom(packet, 7);
+                                  }));
+
+        static_assert(serializeLoadSlotCommand(99).getBytes() == loadSlotCommandPackets[99]);
+        static_assert(serializeLoadSlotCommand(0xc8).getBytes()[v1::SAVE_SLOT] == 0xc8);
+        static_assert(serializeApplyCommand().getBytes() == applyCommandPacket);
+        static_assert(serializeLoadCommand().getBytes() == loadCommandPacket);
+        static_assert(serializeInitCommand()[1].getBytes() == initCommandPackets[1]);
+
+        EXPECT_THAT(serializeLoadSlotCommand(42).getBytes(), ContainerEq(loadSlotCommandPackets[42]));
+    }
+
     TEST_F(PacketSerializerTest, serializeAmpSettingsSetsData)
     {
         constexpr amp_settings settings{amps::METAL_2000, 11, 22, 33, 44, 55, cabinets::cab2x12C, 1, 2, 3, 4, 5, 6, 7, 8, true, 0};
@@ -631,6 +651,14 @@ namespace plug::test
         EXPECT_THAT(packet.getBytes(), KnobsAre(1, 2, 3, 2, 3, 0));
     }
 
+    TEST_F(PacketSerializerTest, serializeEffectSettingsClearsUnusedKnobs)
+    {
+        constexpr fx_pedal_settings settings{FxSlot{1}, effects::EMPTY, 1, 2, 3, 4, 5, 6};
+
+        const auto packet = serializeEffectSettings(settings);
+        EXPECT_THAT(packet.getBytes(), KnobsAre(0, 0, 0, 0, 0, 0));
+    }
+
     TEST_F(PacketSerializerTest, serializeSaveEffectNameData)
     {
         constexpr std::uint8_t slot{7};
@@ -871,65 +899,6 @@ namespace plug::test
         EXPECT_THAT(packet, SizeIs(1));
     }
 
-    TEST_F(PacketSerializerTest, decodePresetListFromData)
-    {
-        const auto emptyData = presetNameEmptyPacket();
-        const std::string name1{"abcdefg"};
-        const std::string name2{"xyz"};
-        const auto presetPacket1 = presetNamePacket(name1);
-        const auto presetPacket2 = presetNamePacket(name2);
-
-        std::vector<Packet<NamePayload>> data{presetPacket1, emptyData, presetPacket2, emptyData};
-
-        const auto result = decodePresetListFromData(data);
-        EXPECT_THAT(result, SizeIs(2));
-        EXPECT_THAT(result[0], StrEq(name1));
-        EXPECT_THAT(result[1], StrEq(name2));
-    }
-
-    TEST_F(PacketSerializerTest, decodePresetListLimitsToMaxReceiveSize)
-    {
-        constexpr std::size_t threshold{143};
-        const auto emptyData = presetNameEmptyPacket();
-        const auto presetPacket = presetNamePacket("abc");
-        const std::vector<Packet<NamePayload>> names((threshold / 2), presetPacket);
-        std::vector<Packet<NamePayload>> dataReduced;
-
-        std::for_each(names.cbegin(), names.cend(), [&dataReduced, &emptyData](const auto& n)
-                      {
-        dataReduced.push_back(n);
-        dataReduced.push_back(emptyData); });
-        std::vector<Packet<NamePayload>> dataFull = dataReduced;
-        dataFull.insert(dataFull.end(), dataReduced.cbegin(), dataReduced.cend());
-
-        EXPECT_THAT(dataFull.size(), Eq(2 * dataReduced.size()));
-
-        const auto resultReduced = decodePresetListFromData(dataReduced);
-        EXPECT_THAT(resultReduced, SizeIs(24));
-
-        const auto resultFull = decodePresetListFromData(dataFull);
-        EXPECT_THAT(resultFull, SizeIs(100));
-    }
-
-    TEST_F(PacketSerializerTest, decodePresetListLimitsNameToLength)
-    {
-        const auto emptyData = presetNameEmptyPacket();
-        constexpr std::size_t limit{32};
-        const std::string name(limit + 10, 'x');
-        const auto presetPacket = presetNamePacket(name);
-        std::vector<Packet<NamePayload>> data{presetPacket, emptyData};
-
-        const auto result = decodePresetListFromData(data);
-        EXPECT_THAT(result[0], SizeIs(limit));
-        EXPECT_THAT(result[0], Not(Contains('\0')));
-    }
-
-    TEST_F(PacketSerializerTest, decodePresetListIsSafeToEmptyData)
-    {
-        const auto result = decodePresetListFromData({});
-        EXPECT_THAT(result, SizeIs(0));
-    }
-
     TEST_F(PacketSerializerTest, decodeNameFromData)
     {
         const std::string name{"test name"};
@@ -1046,6 +1015,24 @@ namespace plug::test
         EXPECT_THROW(decodeAmpFromData(cabinetPackage(0xe0), emptyAmpPayload), std::invalid_argument);
     }
 
+    TEST_F(PacketSerializerTest, tryDecodeAmpFromDataReturnsNothingOnInvalidIds)
+    {
+        EXPECT_THAT(tryDecodeAmpFromData(ampPackage(0xf0), emptyAmpPayload), Eq(std::nullopt));
+        EXPECT_THAT(tryDecodeAmpFromData(cabinetPackage(0xe0), emptyAmpPayload), Eq(std::nullopt));
+        EXPECT_THAT(tryDecodeAmpFromData(ampPackage(0x67), emptyAmpPayload)->amp_num, Eq(amps::FENDER_57_DELUXE));
+    }
+
+    TEST_F(PacketSerializerTest, tryDecodeEffectFromDataReturnsNothingOnInvalidId)
+    {
+        EXPECT_THAT(tryDecodeEffectFromData(effectPackage(0xee)[0]), Eq(std::nullopt));
+        EXPECT_THAT(tryDecodeEffectFromData(effectPackage(0x49)[0])->effect_num, Eq(effects::WAH));
+    }
+
+    TEST_F(PacketSerializerTest, decodeEffectFromDataThrowsOnInvalidEffectId)
+    {
+        EXPECT_THROW(decodeEffectFromData(effectPackage(0xee)[0]), std::invalid_argument);
+    }
+
     TEST_F(PacketSerializerTest, decodeEffectsFromDataSetsData)
     {
         auto package = filledPackage(0x00);
@@ -20,6 +20,7 @@
 
 #include "com/Packet.h"
 #include <gmock/gmock.h>
+#include <utility>
 
 namespace plug::test
 {
@@ -601,4 +602,118 @@ namespace plug::test
 
         EXPECT_THAT(p.getUsbGain(), Eq(0x12));
     }
+
+    TEST_F(PacketTest, packetViewReadsBufferInPlace)
+    {
+        PacketRawType data{};
+        data[2] = 0x07;
+        data[4] = 0x02;
+        data[16] = 0xab;
+        data[32] = 0x11;
+
+        const PacketView<EffectPayload> view{data};
+        data[33] = 0x22;
+
+        EXPECT_THAT(view.getHeader().getDSP(), Eq(DSP::effect1));
+        EXPECT_THAT(view.getHeader().getSlot(), Eq(0x02));
+        EXPECT_THAT(view.getPayload().getModel(), Eq(0xab));
+        EXPECT_THAT(view.getPayload().getKnob1(), Eq(0x11));
+        EXPECT_THAT(view.getPayload().getKnob2(), Eq(0x22));
+        EXPECT_THAT(view.getBytes().data(), Eq(data.data()));
+    }
+
+    TEST_F(PacketTest, mutablePacketViewWritesBuffer)
+    {
+        PacketRawType data{};
+        const MutablePacketView<NamePayload> view{data};
+        view.getHeader().setDSP(DSP::opSaveEffectName);
+        view.getPayload().setName("abc");
+
+        Header h{};
+        h.setDSP(DSP::opSaveEffectName);
+        NamePayload pl{};
+        pl.setName("abc");
+        EXPECT_THAT(data, Eq(Packet<NamePayload>{h, pl}.getBytes()));
+    }
+
+    TEST_F(PacketTest, packetViewOfPacket)
+    {
+        Packet<AmpPayload> packet{};
+        MutablePacketView<AmpPayload>{packet}.getPayload().setGain(0x33);
+
+        const PacketView<AmpPayload> view{packet};
+        EXPECT_THAT(view.getPayload().getGain(), Eq(0x33));
+        EXPECT_THAT(view.getBytes().data(), Eq(packet.getBytes().data()));
+        EXPECT_THAT(Packet<AmpPayload>{view}.getBytes(), Eq(packet.getBytes()));
+    }
+
+    TEST_F(PacketTest, packetViewIsConstexpr)
+    {
+        constexpr auto dsp = []
+        {
+            PacketRawType data{};
+            MutablePacketView<EmptyPayload>{std::span{data}}.getHeader().setDSP(DSP::amp);
+            return PacketView<EmptyPayload>{std::span{std::as_const(data)}}.getHeader().getDSP();
+        }();
+        static_assert(dsp == DSP::amp);
+        static_assert(sizeof(PacketView<AmpPayload>) == sizeof(std::span<const std::uint8_t, packetRawTypeSize>));
+        EXPECT_THAT(dsp, Eq(DSP::amp));
+    }
+
+    TEST_F(PacketTest, fieldLayoutDetectsOverlapsAndOverflow)
+    {
+        static_assert(FieldLayout<PacketField<0>, PacketField<1, 2>, PacketField<3>>::fitsInto<4>());
+        static_assert(!FieldLayout<PacketField<0, 2>, PacketField<1>>::fitsInto<4>());
+        static_assert(!FieldLayout<PacketField<3, 2>>::fitsInto<4>());
+        static_assert(layout::amp::Fields::fitsInto<sizePayload>());
+        static_assert(!FieldLayout<layout::amp::Model, layout::amp::UsbGain>::fitsInto<sizePayload>());
+    }
+
+    TEST_F(PacketTest, fieldAccessUsesDescriptorOffset)
+    {
+        constexpr auto bytes = []
+        {
+            AmpPayload p{};
+            p.set<layout::amp::Treble>(0x1a);
+            p.setSag(0x08);
+            return p.getBytes();
+        }();
+        static_assert(bytes[20] == 0x1a);
+        static_assert(bytes[35] == 0x08);
+
+        NamePayload name{};
+        name.setName(std::string(40, 'x'));
+        EXPECT_THAT(name.field<layout::name::Name>().size(), Eq(32));
+        EXPECT_THAT(name.getName(), Eq(std::string(32, 'x')));
+        EXPECT_THAT(name.getBytes()[32], Eq(0x00));
+    }
+
+    TEST_F(PacketTest, structMappingClampsOnEncode)
+    {
+        struct Settings
+        {
+            std::uint8_t level;
+            std::uint8_t mode;
+            bool enabled;
+        };
+        using Mapping = StructMapping<FieldMapping<PacketField<1>, &Settings::level>,
+                                      FieldMapping<PacketField<4, 1, 0x03>, &Settings::mode>,
+                                      FieldMapping<PacketField<7>, &Settings::enabled>>;
+
+        constexpr auto encoded = []
+        {
+            EffectPayload p{};
+            Mapping::encode(Settings{0x80, 0x09, true}, p);
+            return p;
+        }();
+        static_assert(encoded.getBytes()[1] == 0x80);
+        static_assert(encoded.getBytes()[4] == 0x03);
+        static_assert(encoded.getBytes()[7] == 0x01);
+
+        Settings decoded{};
+        Mapping::decode(encoded, decoded);
+        EXPECT_THAT(decoded.level, Eq(0x80));
+        EXPECT_THAT(decoded.mode, Eq(0x03));
+        EXPECT_THAT(decoded.enabled, IsTrue());
+    }
 }
@@ -0,0 +1,183 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "com/PresetCache.h"
+#include "matcher/TypeMatcher.h"
+#include <gmock/gmock.h>
+#include <sstream>
+
+namespace plug::test
+{
+    using namespace plug::com;
+    using namespace plug::test::matcher;
+    using namespace testing;
+
+    class PresetCacheTest : public testing::Test
+    {
+    protected:
+        const DeviceIdentity device{0x1ed8, 0x0005, "Mustang III/IV/V", "1-2"};
+        const std::vector<std::string> names{"Preset 0", "with spaces ", ""};
+        static constexpr amp_settings amp{amps::BRITISH_60S, 4, 8, 5, 9, 1,
+                                          cabinets::cabBSSMN, 5, 3, 4, 7, 4, 2, 6, 1,
+                                          true, 17};
+        static constexpr fx_pedal_settings effect0{FxSlot{1}, effects::TRIANGLE_FLANGER, 10, 20, 30, 40, 50, 0, true};
+        static constexpr fx_pedal_settings effect1{FxSlot{6}, effects::TAPE_DELAY, 1, 2, 3, 4, 5, 6, false};
+    };
+
+
+    TEST_F(PresetCacheTest, newCacheIsEmpty)
+    {
+        const PresetCache cache{device};
+        EXPECT_THAT(cache.presetNames(), IsEmpty());
+        EXPECT_THAT(cache.bank(0), Eq(std::nullopt));
+        EXPECT_THAT(cache.device(), Eq(device));
+    }
+
+    TEST_F(PresetCacheTest, setPresetNamesReportsChange)
+    {
+        PresetCache cache{device};
+        EXPECT_THAT(cache.setPresetNames(names), IsTrue());
+        EXPECT_THAT(cache.setPresetNames(names), IsFalse());
+        EXPECT_THAT(cache.presetNames(), ContainerEq(names));
+    }
+
+    TEST_F(PresetCacheTest, setBankStoresSignalChain)
+    {
+        PresetCache cache{device};
+        cache.setPresetNames(names);
+        EXPECT_THAT(cache.setBank(1, SignalChain{"with spaces ", amp, {effect0, effect1}}), IsTrue());
+        EXPECT_THAT(cache.setBank(1, SignalChain{"with spaces ", amp, {effect0, effect1}}), IsFalse());
+
+        const auto bank = cache.bank(1);
+        ASSERT_THAT(bank, Ne(std::nullopt));
+        EXPECT_THAT(bank->amp(), AmpIs(amp));
+        EXPECT_THAT(bank->effects(), ElementsAre(EffectIs(effect0), EffectIs(effect1)));
+    }
+
+    TEST_F(PresetCacheTest, setBankUpdatesPresetName)
+    {
+        PresetCache cache{device};
+        cache.setPresetNames(names);
+        cache.setBank(2, SignalChain{"renamed", amp, {}});
+
+        EXPECT_THAT(cache.presetNames()[2], StrEq("renamed"));
+    }
+
+    TEST_F(PresetCacheTest, setPresetNamesDropsOutdatedBanks)
+    {
+        PresetCache cache{device};
+        cache.setPresetNames(names);
+        cache.setBank(0, SignalChain{"Preset 0", amp, {}});
+        cache.setBank(1, SignalChain{"with spaces ", amp, {}});
+
+        cache.setPresetNames({"Preset 0", "changed", ""});
+        EXPECT_THAT(cache.bank(0), Ne(std::nullopt));
+        EXPECT_THAT(cache.bank(1), Eq(std::nullopt));
+    }
+
+    TEST_F(PresetCacheTest, writeAndRead)
+    {
+        PresetCache cache{device};
+        cache.setPresetNames(names);
+        cache.setBank(1, SignalChain{"with spaces ", amp, {effect0, effect1}});
+
+        std::stringstream stream;
+        cache.write(stream);
+        const auto result = PresetCache::read(stream, device);
+
+        ASSERT_THAT(result, Ne(std::nullopt));
+        EXPECT_THAT(result->presetNames(), ContainerEq(names));
+        const auto bank = result->bank(1);
+        ASSERT_THAT(bank, Ne(std::nullopt));
+        EXPECT_THAT(bank->name(), StrEq("with spaces "));
+        EXPECT_THAT(bank->amp(), AmpIs(amp));
+        EXPECT_THAT(bank->effects(), ElementsAre(EffectIs(effect0), EffectIs(effect1)));
+        EXPECT_THAT(bank->effects()[1].enabled, IsFalse());
+    }
+
+    TEST_F(PresetCacheTest, readRejectsOtherDevice)
+    {
+        std::stringstream stream;
+        PresetCache{device}.write(stream);
+
+        EXPECT_THAT(PresetCache::read(stream, DeviceIdentity{0x1ed8, 0x0004, "Mustang III/IV/V", "1-2"}), Eq(std::nullopt));
+    }
+
+    TEST_F(PresetCacheTest, readAcceptsSameDeviceAtOtherLocation)
+    {
+        std::stringstream stream;
+        PresetCache{device}.write(stream);
+
+        EXPECT_THAT(PresetCache::read(stream, DeviceIdentity{0x1ed8, 0x0005, "Mustang III/IV/V", "2-1.4"}), Ne(std::nullopt));
+    }
+
+    TEST_F(PresetCacheTest, readRejectsInvalidData)
+    {
+        std::stringstream invalidHeader{"plug-preset-cache 0\n"};
+        EXPECT_THAT(PresetCache::read(invalidHeader, device), Eq(std::nullopt));
+
+        std::stringstream invalidAmp{"plug-preset-cache 1\ndevice 7896 5 Mustang III/IV/V\nbank 0 x\namp 1 2 3\n"};
+        EXPECT_THAT(PresetCache::read(invalidAmp, device), Eq(std::nullopt));
+
+        std::stringstream missingDevice{"plug-preset-cache 1\npreset 0 x\n"};
+        EXPECT_THAT(PresetCache::read(missingDevice, device), Eq(std::nullopt));
+    }
+
+    TEST_F(PresetCacheTest, readRejectsOutOfRangeModels)
+    {
+        const std::string prefix{"plug-preset-cache 1\ndevice 7896 5 Mustang III/IV/V\nbank 0 x\n"};
+        const std::string validAmp{"amp 7 4 8 5 9 1 2 5 3 4 7 4 2 6 1 1 17\n"};
+
+        std::stringstream valid{prefix + validAmp + "effect 1 11 10 20 30 40 50 0 1\n"};
+        EXPECT_THAT(PresetCache::read(valid, device), Ne(std::nullopt));
+
+        std::stringstream invalidEffect{prefix + validAmp + "effect 1 38 10 20 30 40 50 0 1\n"};
+        EXPECT_THAT(PresetCache::read(invalidEffect, device), Eq(std::nullopt));
+
+        std::stringstream invalidAmp{prefix + "amp 17 4 8 5 9 1 2 5 3 4 7 4 2 6 1 1 17\n"};
+        EXPECT_THAT(PresetCache::read(invalidAmp, device), Eq(std::nullopt));
+
+        std::stringstream invalidCabinet{prefix + "amp 7 4 8 5 9 1 13 5 3 4 7 4 2 6 1 1 17\n"};
+        EXPECT_THAT(PresetCache::read(invalidCabinet, device), Eq(std::nullopt));
+    }
+
+    TEST_F(PresetCacheTest, fileNameContainsDeviceIdentity)
+    {
+        EXPECT_THAT(PresetCache{device}.fileName(), StrEq("1ed8-0005-Mustang_III_IV_V.cache"));
+    }
+
+    TEST_F(PresetCacheTest, saveAndLoadFromDirectory)
+    {
+        const auto directory = std::filesystem::path{testing::TempDir()} / "plug-preset-cache-test";
+        PresetCache cache{device};
+        cache.setPresetNames(names);
+
+        EXPECT_THAT(savePresetCache(directory, cache), IsTrue());
+        const auto result = loadPresetCache(directory, device);
+        ASSERT_THAT(result, Ne(std::nullopt));
+        EXPECT_THAT(result->presetNames(), ContainerEq(names));
+
+        std::filesystem::remove_all(directory);
+    }
+
+    TEST_F(PresetCacheTest, loadReturnsNothingIfNotCached)
+    {
+        EXPECT_THAT(loadPresetCache(std::filesystem::path{testing::TempDir()} / "plug-no-cache", device), Eq(std::nullopt));
+    }
+}
@@ -23,6 +23,7 @@
 #include "mocks/UsbDeviceMock.h"
 #include "matcher/Matcher.h"
 #include <array>
+#include <memory>
 #include <gmock/gmock.h>
 
 namespace plug::test
@@ -47,17 +48,18 @@ namespace plug::test
 
         UsbComm create() const
         {
-            return UsbComm{Device{nullptr}};
+            return UsbComm{Device{nullptr, context}};
         }
 
         mock::UsbDeviceMock* deviceMock{nullptr};
+        std::shared_ptr<plug::com::usb::Context> context{std::make_shared<plug::com::usb::Context>()};
     };
 
     TEST_F(UsbCommTest, ctorOpensDevice)
     {
         EXPECT_CALL(*deviceMock, open());
         EXPECT_CALL(*deviceMock, name());
-        UsbComm com{Device{nullptr}};
+        UsbComm com{Device{nullptr, context}};
     }
 
     TEST_F(UsbCommTest, closeClosesDevice)
@@ -108,6 +110,48 @@ namespace plug::test
         EXPECT_THAT(received, Eq(data));
     }
 
+    TEST_F(UsbCommTest, receiveIntoBufferReceivesData)
+    {
+        EXPECT_CALL(*deviceMock, open());
+        EXPECT_CALL(*deviceMock, name());
+
+        std::array<std::uint8_t, 64> buffer{{}};
+        EXPECT_CALL(*deviceMock, receive(0x81, buffer.data(), buffer.size())).WillOnce(Return(5));
+
+        UsbComm com = create();
+        EXPECT_THAT(com.receive(std::span{buffer}), Eq(5));
+    }
+
+    TEST_F(UsbCommTest, receiveAsyncSubmitsReceive)
+    {
+        EXPECT_CALL(*deviceMock, open());
+        EXPECT_CALL(*deviceMock, name());
+
+        const std::vector<std::uint8_t> data{{0x00, 0xa1, 0xb2, 0xb3, 0xc4}};
+        std::promise<std::vector<std::uint8_t>> completion;
+        EXPECT_CALL(*deviceMock, receiveAsync(0x81, data.size())).WillOnce(Return(ByMove(completion.get_future())));
+
+        UsbComm com = create();
+        auto pending = com.receiveAsync(data.size());
+        completion.set_value(data);
+        EXPECT_THAT(pending.get(), Eq(data));
+    }
+
+    TEST_F(UsbCommTest, receiveAsyncIntoBufferSubmitsReceive)
+    {
+        EXPECT_CALL(*deviceMock, open());
+        EXPECT_CALL(*deviceMock, name());
+
+        std::array<std::uint8_t, 5> buffer{};
+        std::promise<std::size_t> completion;
+        EXPECT_CALL(*deviceMock, receiveAsync(0x81, buffer.data(), buffer.size())).WillOnce(Return(ByMove(completion.get_future())));
+
+        UsbComm com = create();
+        auto pending = com.receiveAsync(std::span{buffer});
+        completion.set_value(3);
+        EXPECT_THAT(pending.get(), Eq(3));
+    }
+
     TEST_F(UsbCommTest, modelName)
     {
         EXPECT_CALL(*deviceMock, open());
@@ -22,6 +22,8 @@
 #include "com/UsbException.h"
 #include "mocks/LibUsbMocks.h"
 #include <array>
+#include <memory>
+#include <thread>
 #include <libusb-1.0/libusb.h>
 #include <gmock/gmock.h>
 
@@ -43,42 +45,72 @@ namespace plug::test
         void SetUp() override
         {
             usbmock = mock::resetUsbMock();
+            EXPECT_CALL(*usbmock, init(_)).WillOnce(DoAll(SetArgPointee<0>(&session), Return(LIBUSB_SUCCESS)));
+            EXPECT_CALL(*usbmock, exit(&session));
+            context = std::make_shared<Context>();
         }
 
         void TearDown() override
         {
+            context.reset();
             mock::clearUsbMock();
         }
 
+        void expectOpenAndClose()
+        {
+            EXPECT_CALL(*usbmock, ref_device(_)).WillOnce(Return(&dev));
+            EXPECT_CALL(*usbmock, get_device_descriptor(_, _)).WillOnce(DoAll(SetArgPointee<1>(libusb_device_descriptor{}), Return(LIBUSB_SUCCESS)));
+            EXPECT_CALL(*usbmock, unref_device(_));
+            EXPECT_CALL(*usbmock, open(_, _))
+                .WillOnce(DoAll(SetArgPointee<1>(handle), Return(LIBUSB_SUCCESS)));
+            EXPECT_CALL(*usbmock, set_auto_detach_kernel_driver(_, _)).WillOnce(Return(LIBUSB_SUCCESS));
+            EXPECT_CALL(*usbmock, claim_interface(_, _)).WillOnce(Return(LIBUSB_SUCCESS));
+            EXPECT_CALL(*usbmock, release_interface(_, _)).WillOnce(Return(LIBUSB_SUCCESS));
+            EXPECT_CALL(*usbmock, close(_));
+        }
+
+        void complete(libusb_transfer_status status, int transfered)
+        {
+            transfer->status = status;
+            transfer->actual_length = transfered;
+            transfer->callback(transfer);
+        }
+
         mock::UsbMock* usbmock{nullptr};
+        std::unique_ptr<libusb_transfer> transferBuffer{std::make_unique<libusb_transfer>()};
+        libusb_transfer* transfer{transferBuffer.get()};
         libusb_device dev;
         libusb_device_handle dummy;
         libusb_device_handle* handle{&dummy};
+        libusb_context ctx{};
+        libusb_context session{};
+        std::shared_ptr<Context> context;
     };
 
-    TEST_F(UsbTest, contextCtorInitializesDefaultContext)
+    TEST_F(UsbTest, contextCtorInitializesOwnContext)
     {
-        EXPECT_CALL(*usbmock, init(nullptr)).WillOnce(Return(LIBUSB_SUCCESS));
-        EXPECT_CALL(*usbmock, exit(_));
+        EXPECT_CALL(*usbmock, init(NotNull())).WillOnce(DoAll(SetArgPointee<0>(&ctx), Return(LIBUSB_SUCCESS)));
+        EXPECT_CALL(*usbmock, exit(&ctx));
 
-        Context context;
+        Context ownContext;
+        EXPECT_THAT(ownContext.get(), Eq(&ctx));
     }
 
     TEST_F(UsbTest, contextCtorThrowsOnInitError)
     {
-        EXPECT_CALL(*usbmock, init(nullptr)).WillOnce(Return(LIBUSB_ERROR_OTHER));
+        EXPECT_CALL(*usbmock, init(NotNull())).WillOnce(Return(LIBUSB_ERROR_OTHER));
         EXPECT_CALL(*usbmock, error_name(LIBUSB_ERROR_OTHER)).WillOnce(Return("ignore_name"));
         EXPECT_CALL(*usbmock, strerror(LIBUSB_ERROR_OTHER)).WillOnce(Return("ignore_message"));
 
         EXPECT_THROW(Context{}, UsbException);
     }
 
-    TEST_F(UsbTest, contextDtorDeinitializesDefaultContext)
+    TEST_F(UsbTest, contextDtorDeinitializesOwnContext)
     {
-        EXPECT_CALL(*usbmock, init(_)).WillOnce(Return(LIBUSB_SUCCESS));
-        EXPECT_CALL(*usbmock, exit(nullptr));
+        EXPECT_CALL(*usbmock, init(_)).WillOnce(DoAll(SetArgPointee<0>(&ctx), Return(LIBUSB_SUCCESS)));
+        EXPECT_CALL(*usbmock, exit(&ctx));
 
-        Context ctx{};
+        Context ownContext{};
     }
 
     TEST_F(UsbTest, exceptionContainsErrorInformation)
@@ -95,10 +127,10 @@ namespace plug::test
 
     TEST_F(UsbTest, listDevicesEmptyIfNoDevices)
     {
-        EXPECT_CALL(*usbmock, get_device_list(nullptr, _)).WillOnce(Return(0));
+        EXPECT_CALL(*usbmock, get_device_list(&session, _)).WillOnce(Return(0));
         EXPECT_CALL(*usbmock, free_device_list(_, _));
 
-        const auto devices = listDevices();
+        const auto devices = listDevices(context);
         EXPECT_THAT(devices, SizeIs(0));
     }
 
@@ -108,7 +140,7 @@ namespace plug::test
         EXPECT_CALL(*usbmock, strerror(_)).WillOnce(Return("ignore_message"));
 
         EXPECT_CALL(*usbmock, get_device_list(_, _)).WillOnce(Return(LIBUSB_ERROR_OTHER));
-        EXPECT_THROW(listDevices(), UsbException);
+        EXPECT_THROW(listDevices(context), UsbException);
     }
 
     TEST_F(UsbTest, listDevicesReturnsDevices)
@@ -118,7 +150,7 @@ namespace plug::test
         libusb_device device0;
         libusb_device device1;
         std::array<libusb_device*, 2> deviceList{&device0, &device1};
-        EXPECT_CALL(*usbmock, get_device_list(nullptr, NotNull()))
+        EXPECT_CALL(*usbmock, get_device_list(&session, NotNull()))
             .WillOnce(DoAll(SetArgPointee<1>(deviceList.data()),
                             Return(deviceList.size())));
         libusb_device_descriptor descr0{};
@@ -132,7 +164,7 @@ namespace plug::test
             .WillOnce(DoAll(SetArgPointee<1>(descr1), Return(LIBUSB_SUCCESS)));
         EXPECT_CALL(*usbmock, free_device_list(_, _));
 
-        const auto devices = listDevices();
+        const auto devices = listDevices(context);
         EXPECT_THAT(devices, SizeIs(2));
         EXPECT_THAT(devices[0].vendorId(), Eq(0xabcd));
         EXPECT_THAT(devices[0].productId(), Eq(0x1221));
@@ -145,14 +177,14 @@ namespace plug::test
         EXPECT_CALL(*usbmock, ref_device(_));
 
         std::array<libusb_device*, 1> deviceList{&dev};
-        EXPECT_CALL(*usbmock, get_device_list(nullptr, NotNull()))
+        EXPECT_CALL(*usbmock, get_device_list(&session, NotNull()))
             .WillOnce(DoAll(SetArgPointee<1>(deviceList.data()),
                             Return(deviceList.size())));
         EXPECT_CALL(*usbmock, get_device_descriptor(NotNull(), NotNull()))
             .WillOnce(DoAll(SetArgPointee<1>(libusb_device_descriptor{}), Return(LIBUSB_SUCCESS)));
         EXPECT_CALL(*usbmock, free_device_list(NotNull(), 1));
 
-        listDevices();
+        listDevices(context);
     }
 
     TEST_F(UsbTest, listDevicesSkipsDeviceOnFailingDescriptor)
@@ -162,7 +194,7 @@ namespace plug::test
         libusb_device device0;
         libusb_device device1;
         std::array<libusb_device*, 2> deviceList{&device0, &device1};
-        EXPECT_CALL(*usbmock, get_device_list(nullptr, NotNull()))
+        EXPECT_CALL(*usbmock, get_device_list(&session, NotNull()))
             .WillOnce(DoAll(SetArgPointee<1>(deviceList.data()),
                             Return(deviceList.size())));
         libusb_device_descriptor descr0{};
@@ -178,18 +210,50 @@ namespace plug::test
         EXPECT_CALL(*usbmock, error_name(LIBUSB_ERROR_ACCESS)).WillOnce(Return("ignore_name"));
         EXPECT_CALL(*usbmock, strerror(LIBUSB_ERROR_ACCESS)).WillOnce(Return("ignore_message"));
 
-        const auto devices = listDevices();
+        const auto devices = listDevices(context);
         EXPECT_THAT(devices, SizeIs(1));
         EXPECT_THAT(devices[0].vendorId(), Eq(0x1234));
     }
 
+    TEST_F(UsbTest, listDevicesUsesContext)
+    {
+        EXPECT_CALL(*usbmock, init(_)).WillOnce(DoAll(SetArgPointee<0>(&ctx), Return(LIBUSB_SUCCESS)));
+        EXPECT_CALL(*usbmock, get_device_list(&ctx, NotNull())).WillOnce(Return(0));
+        EXPECT_CALL(*usbmock, free_device_list(_, _));
+        EXPECT_CALL(*usbmock, exit(&ctx));
+
+        listDevices(std::make_shared<Context>());
+    }
+
+    TEST_F(UsbTest, devicesKeepContextAlive)
+    {
+        EXPECT_CALL(*usbmock, init(_)).WillOnce(DoAll(SetArgPointee<0>(&ctx), Return(LIBUSB_SUCCESS)));
+        std::array<libusb_device*, 1> deviceList{&dev};
+        EXPECT_CALL(*usbmock, get_device_list(&ctx, NotNull()))
+            .WillOnce(DoAll(SetArgPointee<1>(deviceList.data()),
+                            Return(deviceList.size())));
+        EXPECT_CALL(*usbmock, ref_device(_)).WillOnce(Return(&dev));
+        EXPECT_CALL(*usbmock, get_device_descriptor(NotNull(), NotNull()))
+            .WillOnce(DoAll(SetArgPointee<1>(libusb_device_descriptor{}), Return(LIBUSB_SUCCESS)));
+        EXPECT_CALL(*usbmock, free_device_list(_, _));
+
+        auto devices = listDevices(std::make_shared<Context>());
+        ASSERT_THAT(devices, SizeIs(1));
+        EXPECT_THAT(devices[0].context()->get(), Eq(&ctx));
+
+        InSequence s;
+        EXPECT_CALL(*usbmock, unref_device(_));
+        EXPECT_CALL(*usbmock, exit(&ctx));
+        devices.clear();
+    }
+
     TEST_F(UsbTest, deviceRefsDevice)
     {
         EXPECT_CALL(*usbmock, ref_device(&dev)).WillOnce(Return(&dev));
         EXPECT_CALL(*usbmock, unref_device(_));
         EXPECT_CALL(*usbmock, get_device_descriptor(NotNull(), NotNull())).WillOnce(Return(LIBUSB_SUCCESS));
 
-        Device device{&dev};
+        Device device{&dev, context};
     }
 
     TEST_F(UsbTest, deviceUnRefsDeviceOnDestruction)
@@ -198,7 +262,7 @@ namespace plug::test
         EXPECT_CALL(*usbmock, unref_device(&dev));
         EXPECT_CALL(*usbmock, get_device_descriptor(NotNull(), NotNull())).WillOnce(Return(LIBUSB_SUCCESS));
 
-        Device device{&dev};
+        Device device{&dev, context};
     }
 
     TEST_F(UsbTest, deviceOpen)
@@ -213,7 +277,7 @@ namespace plug::test
         EXPECT_CALL(*usbmock, release_interface(_, _));
         EXPECT_CALL(*usbmock, close(_));
 
-        Device device{&dev};
+        Device device{&dev, context};
         device.open();
         EXPECT_TRUE(device.isOpen());
     }
@@ -227,7 +291,7 @@ namespace plug::test
         EXPECT_CALL(*usbmock, error_name(LIBUSB_ERROR_ACCESS)).WillOnce(Return("ignore_name"));
         EXPECT_CALL(*usbmock, strerror(LIBUSB_ERROR_ACCESS)).WillOnce(Return("ignore_message"));
 
-        Device device{&dev};
+        Device device{&dev, context};
         EXPECT_THROW(device.open(), UsbException);
     }
 
@@ -244,7 +308,7 @@ namespace plug::test
         EXPECT_CALL(*usbmock, error_name(LIBUSB_ERROR_NO_MEM)).WillOnce(Return("ignore_name"));
         EXPECT_CALL(*usbmock, strerror(LIBUSB_ERROR_NO_MEM)).WillOnce(Return("ignore_message"));
 
-        Device device{&dev};
+        Device device{&dev, context};
         EXPECT_THROW(device.open(), UsbException);
     }
 
@@ -262,7 +326,7 @@ namespace plug::test
         EXPECT_CALL(*usbmock, error_name(LIBUSB_ERROR_BUSY)).WillOnce(Return("ignore_name"));
         EXPECT_CALL(*usbmock, strerror(LIBUSB_ERROR_BUSY)).WillOnce(Return("ignore_message"));
 
-        Device device{&dev};
+        Device device{&dev, context};
         EXPECT_THROW(device.open(), UsbException);
     }
 
@@ -272,7 +336,7 @@ namespace plug::test
         EXPECT_CALL(*usbmock, ref_device(_)).WillOnce(Return(&dev));
         EXPECT_CALL(*usbmock, unref_device(_));
 
-        Device device{&dev};
+        Device device{&dev, context};
         EXPECT_FALSE(device.isOpen());
     }
 
@@ -288,7 +352,7 @@ namespace plug::test
         EXPECT_CALL(*usbmock, release_interface(handle, 0)).WillOnce(Return(LIBUSB_SUCCESS));
         EXPECT_CALL(*usbmock, close(handle));
 
-        Device device{&dev};
+        Device device{&dev, context};
         device.open();
         EXPECT_TRUE(device.isOpen());
         device.close();
@@ -301,7 +365,7 @@ namespace plug::test
         EXPECT_CALL(*usbmock, ref_device(_)).WillOnce(Return(&dev));
         EXPECT_CALL(*usbmock, unref_device(_));
 
-        Device device{&dev};
+        Device device{&dev, context};
         device.close();
         EXPECT_FALSE(device.isOpen());
     }
@@ -318,7 +382,7 @@ namespace plug::test
         EXPECT_CALL(*usbmock, release_interface(_, _)).WillOnce(Return(LIBUSB_ERROR_NO_DEVICE));
         EXPECT_CALL(*usbmock, close(handle));
 
-        Device device{&dev};
+        Device device{&dev, context};
         device.open();
         EXPECT_TRUE(device.isOpen());
         device.close();
@@ -337,7 +401,7 @@ namespace plug::test
         EXPECT_CALL(*usbmock, release_interface(_, _)).WillOnce(Return(LIBUSB_ERROR_NO_DEVICE));
         EXPECT_CALL(*usbmock, close(handle));
 
-        Device device{&dev};
+        Device device{&dev, context};
         device.open();
     }
 
@@ -357,7 +421,7 @@ namespace plug::test
         EXPECT_CALL(*usbmock, release_interface(_, _)).WillOnce(Return(LIBUSB_SUCCESS));
         EXPECT_CALL(*usbmock, close(_));
 
-        Device device{&dev};
+        Device device{&dev, context};
         device.open();
         EXPECT_THAT(device.name(), StrEq("usb-device-0"));
     }
@@ -378,7 +442,7 @@ namespace plug::test
         EXPECT_CALL(*usbmock, release_interface(_, _)).WillOnce(Return(LIBUSB_SUCCESS));
         EXPECT_CALL(*usbmock, close(_));
 
-        Device device{&dev};
+        Device device{&dev, context};
         device.open();
         EXPECT_THAT(device.name(), SizeIs(0));
     }
@@ -401,11 +465,41 @@ namespace plug::test
         EXPECT_CALL(*usbmock, error_name(LIBUSB_ERROR_TIMEOUT)).WillOnce(Return("ignore_name"));
         EXPECT_CALL(*usbmock, strerror(LIBUSB_ERROR_TIMEOUT)).WillOnce(Return("ignore_message"));
 
-        Device device{&dev};
+        Device device{&dev, context};
         device.open();
         EXPECT_THROW(device.name(), UsbException);
     }
 
+    TEST_F(UsbTest, deviceLocationReturnsBusAndPortPathWithoutOpening)
+    {
+        EXPECT_CALL(*usbmock, ref_device(_)).WillOnce(Return(&dev));
+        libusb_device_descriptor descr{};
+        EXPECT_CALL(*usbmock, get_device_descriptor(NotNull(), NotNull())).WillOnce(DoAll(SetArgPointee<1>(descr), Return(LIBUSB_SUCCESS)));
+        EXPECT_CALL(*usbmock, unref_device(_));
+        const std::array<std::uint8_t, 2> ports{{2, 3}};
+        EXPECT_CALL(*usbmock, get_port_numbers(&dev, NotNull(), 7))
+            .WillOnce(DoAll(SetArrayArgument<1>(ports.begin(), ports.end()), Return(ports.size())));
+        EXPECT_CALL(*usbmock, get_bus_number(&dev)).WillOnce(Return(1));
+        EXPECT_CALL(*usbmock, open(_, _)).Times(0);
+
+        Device device{&dev, context};
+        EXPECT_THAT(device.location(), StrEq("1-2.3"));
+    }
+
+    TEST_F(UsbTest, deviceLocationThrowsOnError)
+    {
+        EXPECT_CALL(*usbmock, ref_device(_)).WillOnce(Return(&dev));
+        libusb_device_descriptor descr{};
+        EXPECT_CALL(*usbmock, get_device_descriptor(NotNull(), NotNull())).WillOnce(DoAll(SetArgPointee<1>(descr), Return(LIBUSB_SUCCESS)));
+        EXPECT_CALL(*usbmock, unref_device(_));
+        EXPECT_CALL(*usbmock, get_port_numbers(&dev, NotNull(), 7)).WillOnce(Return(LIBUSB_ERROR_OVERFLOW));
+        EXPECT_CALL(*usbmock, error_name(LIBUSB_ERROR_OVERFLOW)).WillOnce(Return("ignore_name"));
+        EXPECT_CALL(*usbmock, strerror(LIBUSB_ERROR_OVERFLOW)).WillOnce(Return("ignore_message"));
+
+        Device device{&dev, context};
+        EXPECT_THROW(device.location(), UsbException);
+    }
+
     TEST_F(UsbTest, writeTransmitsData)
     {
         EXPECT_CALL(*usbmock, ref_device(_)).WillOnce(Return(&dev));
@@ -423,7 +517,7 @@ namespace plug::test
         EXPECT_CALL(*usbmock, interrupt_transfer(handle, 0xab, buffer.data(), buffer.size(), NotNull(), 500))
             .WillOnce(DoAll(SetArgPointee<4>(buffer.size()), Return(LIBUSB_SUCCESS)));
 
-        Device device{&dev};
+        Device device{&dev, context};
         device.open();
         EXPECT_THAT(device.write(0xab, buffer.data(), buffer.size()), Eq(buffer.size()));
     }
@@ -445,7 +539,7 @@ namespace plug::test
         EXPECT_CALL(*usbmock, interrupt_transfer(handle, 0xab, buffer.data(), buffer.size(), NotNull(), 500))
             .WillOnce(DoAll(SetArgPointee<4>(3), Return(LIBUSB_SUCCESS)));
 
-        Device device{&dev};
+        Device device{&dev, context};
         device.open();
         EXPECT_THAT(device.write(0xab, buffer.data(), buffer.size()), Eq(3));
     }
@@ -468,7 +562,7 @@ namespace plug::test
         std::array<std::uint8_t, 4> buffer{{0x00, 0x01, 0x02, 0x03}};
         EXPECT_CALL(*usbmock, interrupt_transfer(_, _, _, _, _, _)).WillOnce(Return(LIBUSB_ERROR_NOT_FOUND));
 
-        Device device{&dev};
+        Device device{&dev, context};
         device.open();
         EXPECT_THROW(device.write(0xab, buffer.data(), buffer.size()), UsbException);
     }
@@ -490,7 +584,7 @@ namespace plug::test
         EXPECT_CALL(*usbmock, interrupt_transfer(handle, 0xcd, NotNull(), buffer.size(), NotNull(), 500))
             .WillOnce(DoAll(SetArrayArgument<2>(buffer.begin(), buffer.end()), SetArgPointee<4>(buffer.size()), Return(LIBUSB_SUCCESS)));
 
-        Device device{&dev};
+        Device device{&dev, context};
         device.open();
         EXPECT_THAT(device.receive(0xcd, buffer.size()), BufferIs(buffer));
     }
@@ -512,7 +606,7 @@ namespace plug::test
         EXPECT_CALL(*usbmock, interrupt_transfer(handle, 0xcd, NotNull(), buffer.size(), NotNull(), 500))
             .WillOnce(DoAll(SetArrayArgument<2>(buffer.begin(), std::next(buffer.begin(), 2)), SetArgPointee<4>(2), Return(LIBUSB_SUCCESS)));
 
-        Device device{&dev};
+        Device device{&dev, context};
         device.open();
         EXPECT_THAT(device.receive(0xcd, buffer.size()), BufferIs(std::array<std::uint8_t, 2>{{0x10, 0x11}}));
     }
@@ -532,7 +626,7 @@ namespace plug::test
 
         EXPECT_CALL(*usbmock, interrupt_transfer(_, _, _, _, _, _)).WillOnce(Return(LIBUSB_ERROR_TIMEOUT));
 
-        Device device{&dev};
+        Device device{&dev, context};
         device.open();
         EXPECT_THAT(device.receive(0x88, 99), SizeIs(0));
     }
@@ -554,8 +648,288 @@ namespace plug::test
 
         EXPECT_CALL(*usbmock, interrupt_transfer(_, _, _, _, _, _)).WillOnce(Return(LIBUSB_ERROR_ACCESS));
 
-        Device device{&dev};
+        Device device{&dev, context};
         device.open();
         EXPECT_THROW(device.receive(0x33, 17), UsbException);
     }
+
+    TEST_F(UsbTest, receiveIntoBufferReceivesData)
+    {
+        expectOpenAndClose();
+
+        const std::array<std::uint8_t, 4> data{{0x10, 0x11, 0x12, 0x13}};
+        std::array<std::uint8_t, 64> buffer{{}};
+        EXPECT_CALL(*usbmock, interrupt_transfer(handle, 0xcd, buffer.data(), buffer.size(), NotNull(), 500))
+            .WillOnce(DoAll(SetArrayArgument<2>(data.begin(), data.end()), SetArgPointee<4>(data.size()), Return(LIBUSB_SUCCESS)));
+
+        Device device{&dev, context};
+        device.open();
+        EXPECT_THAT(device.receive(0xcd, buffer.data(), buffer.size()), Eq(data.size()));
+        EXPECT_THAT(buffer, BufferIs(data));
+    }
+
+    TEST_F(UsbTest, receiveIntoBufferReturnsZeroOnTimeout)
+    {
+        expectOpenAndClose();
+        EXPECT_CALL(*usbmock, interrupt_transfer(_, _, _, _, _, _)).WillOnce(Return(LIBUSB_ERROR_TIMEOUT));
+
+        std::array<std::uint8_t, 64> buffer{{}};
+        Device device{&dev, context};
+        device.open();
+        EXPECT_THAT(device.receive(0xcd, buffer.data(), buffer.size()), Eq(0));
+    }
+
+    TEST_F(UsbTest, writeAsyncSubmitsTransfer)
+    {
+        expectOpenAndClose();
+        EXPECT_CALL(*usbmock, alloc_transfer(0)).WillOnce(Return(transfer));
+        EXPECT_CALL(*usbmock, submit_transfer(transfer)).WillOnce(Return(LIBUSB_SUCCESS));
+        EXPECT_CALL(*usbmock, free_transfer(transfer));
+
+        std::array<std::uint8_t, 4> buffer{{0x00, 0x01, 0x02, 0x03}};
+        Device device{&dev, context};
+        device.open();
+        auto pending = device.writeAsync(0xab, buffer.data(), buffer.size());
+        buffer.fill(0xff);
+
+        EXPECT_THAT(transfer->dev_handle, Eq(handle));
+        EXPECT_THAT(transfer->endpoint, Eq(0xab));
+        EXPECT_THAT(transfer->type, Eq(LIBUSB_TRANSFER_TYPE_INTERRUPT));
+        EXPECT_THAT(transfer->timeout, Eq(500));
+        EXPECT_THAT(transfer->length, Eq(4));
+        EXPECT_THAT(std::vector<std::uint8_t>(transfer->buffer, std::next(transfer->buffer, transfer->length)), ElementsAre(0x00, 0x01, 0x02, 0x03));
+
+        complete(LIBUSB_TRANSFER_COMPLETED, 4);
+        EXPECT_THAT(pending.get(), Eq(buffer.size()));
+    }
+
+    TEST_F(UsbTest, writeAsyncThrowsOnSubmitFailure)
+    {
+        expectOpenAndClose();
+        EXPECT_CALL(*usbmock, alloc_transfer(0)).WillOnce(Return(transfer));
+        EXPECT_CALL(*usbmock, submit_transfer(transfer)).WillOnce(Return(LIBUSB_ERROR_NO_DEVICE));
+        EXPECT_CALL(*usbmock, free_transfer(transfer));
+        EXPECT_CALL(*usbmock, error_name(LIBUSB_ERROR_NO_DEVICE)).WillOnce(Return("ignore_name"));
+        EXPECT_CALL(*usbmock, strerror(LIBUSB_ERROR_NO_DEVICE)).WillOnce(Return("ignore_message"));
+
+        std::array<std::uint8_t, 4> buffer{{0x00, 0x01, 0x02, 0x03}};
+        Device device{&dev, context};
+        device.open();
+        EXPECT_THROW(device.writeAsync(0xab, buffer.data(), buffer.size()), UsbException);
+    }
+
+    TEST_F(UsbTest, writeAsyncReportsTimeoutAsError)
+    {
+        expectOpenAndClose();
+        EXPECT_CALL(*usbmock, alloc_transfer(0)).WillOnce(Return(transfer));
+        EXPECT_CALL(*usbmock, submit_transfer(transfer)).WillOnce(Return(LIBUSB_SUCCESS));
+        EXPECT_CALL(*usbmock, free_transfer(transfer));
+        EXPECT_CALL(*usbmock, error_name(LIBUSB_ERROR_TIMEOUT)).WillOnce(Return("ignore_name"));
+        EXPECT_CALL(*usbmock, strerror(LIBUSB_ERROR_TIMEOUT)).WillOnce(Return("ignore_message"));
+
+        std::array<std::uint8_t, 4> buffer{{0x00, 0x01, 0x02, 0x03}};
+        Device device{&dev, context};
+        device.open();
+        auto pending = device.writeAsync(0xab, buffer.data(), buffer.size());
+        complete(LIBUSB_TRANSFER_TIMED_OUT, 0);
+        EXPECT_THROW(pending.get(), UsbException);
+    }
+
+    TEST_F(UsbTest, receiveAsyncReceivesData)
+    {
+        expectOpenAndClose();
+        EXPECT_CALL(*usbmock, alloc_transfer(0)).WillOnce(Return(transfer));
+        EXPECT_CALL(*usbmock, submit_transfer(transfer)).WillOnce(Return(LIBUSB_SUCCESS));
+        EXPECT_CALL(*usbmock, free_transfer(transfer));
+
+        Device device{&dev, context};
+        device.open();
+        auto pending = device.receiveAsync(0xcd, 4);
+
+        EXPECT_THAT(transfer->endpoint, Eq(0xcd));
+        EXPECT_THAT(transfer->length, Eq(4));
+        const std::array<std::uint8_t, 3> data{{0x10, 0x11, 0x12}};
+        std::copy(data.cbegin(), data.cend(), transfer->buffer);
+        complete(LIBUSB_TRANSFER_COMPLETED, data.size());
+
+        const auto received = pending.get();
+        EXPECT_THAT(received, SizeIs(3));
+        EXPECT_THAT(received, BufferIs(data));
+    }
+
+    TEST_F(UsbTest, receiveAsyncIntoBufferReceivesData)
+    {
+        expectOpenAndClose();
+        EXPECT_CALL(*usbmock, alloc_transfer(0)).WillOnce(Return(transfer));
+        EXPECT_CALL(*usbmock, submit_transfer(transfer)).WillOnce(Return(LIBUSB_SUCCESS));
+        EXPECT_CALL(*usbmock, free_transfer(transfer));
+
+        std::array<std::uint8_t, 4> buffer{};
+        Device device{&dev, context};
+        device.open();
+        auto pending = device.receiveAsync(0xcd, buffer.data(), buffer.size());
+
+        EXPECT_THAT(transfer->endpoint, Eq(0xcd));
+        EXPECT_THAT(transfer->buffer, Eq(buffer.data()));
+        EXPECT_THAT(transfer->length, Eq(4));
+        complete(LIBUSB_TRANSFER_COMPLETED, 3);
+
+        EXPECT_THAT(pending.get(), Eq(3));
+    }
+
+    TEST_F(UsbTest, receiveAsyncReturnsEmptyOnTimeout)
+    {
+        expectOpenAndClose();
+        EXPECT_CALL(*usbmock, alloc_transfer(0)).WillOnce(Return(transfer));
+        EXPECT_CALL(*usbmock, submit_transfer(transfer)).WillOnce(Return(LIBUSB_SUCCESS));
+        EXPECT_CALL(*usbmock, free_transfer(transfer));
+
+        Device device{&dev, context};
+        device.open();
+        auto pending = device.receiveAsync(0xcd, 64);
+        complete(LIBUSB_TRANSFER_TIMED_OUT, 0);
+        EXPECT_THAT(pending.get(), SizeIs(0));
+    }
+
+    TEST_F(UsbTest, receiveAsyncReportsTransferFailure)
+    {
+        expectOpenAndClose();
+        EXPECT_CALL(*usbmock, alloc_transfer(0)).WillOnce(Return(transfer));
+        EXPECT_CALL(*usbmock, submit_transfer(transfer)).WillOnce(Return(LIBUSB_SUCCESS));
+        EXPECT_CALL(*usbmock, free_transfer(transfer));
+        EXPECT_CALL(*usbmock, error_name(LIBUSB_ERROR_NO_DEVICE)).WillOnce(Return("ignore_name"));
+        EXPECT_CALL(*usbmock, strerror(LIBUSB_ERROR_NO_DEVICE)).WillOnce(Return("ignore_message"));
+
+        Device device{&dev, context};
+        device.open();
+        auto pending = device.receiveAsync(0xcd, 64);
+        complete(LIBUSB_TRANSFER_NO_DEVICE, 0);
+        EXPECT_THROW(pending.get(), UsbException);
+    }
+
+    TEST_F(UsbTest, asyncTransfersCanBeInFlightConcurrently)
+    {
+        expectOpenAndClose();
+        auto second = std::make_unique<libusb_transfer>();
+        EXPECT_CALL(*usbmock, alloc_transfer(0)).WillOnce(Return(transfer)).WillOnce(Return(second.get()));
+        EXPECT_CALL(*usbmock, submit_transfer(_)).WillRepeatedly(Return(LIBUSB_SUCCESS));
+        EXPECT_CALL(*usbmock, free_transfer(_)).Times(2);
+
+        std::array<std::uint8_t, 2> buffer{{0x01, 0x02}};
+        Device device{&dev, context};
+        device.open();
+        auto write = device.writeAsync(0x01, buffer.data(), buffer.size());
+        auto read = device.receiveAsync(0x81, 2);
+
+        second->status = LIBUSB_TRANSFER_COMPLETED;
+        second->actual_length = 2;
+        second->callback(second.get());
+        EXPECT_THAT(read.get(), SizeIs(2));
+        EXPECT_THAT(write.wait_for(std::chrono::seconds{0}), Eq(std::future_status::timeout));
+
+        complete(LIBUSB_TRANSFER_COMPLETED, 2);
+        EXPECT_THAT(write.get(), Eq(2));
+    }
+
+    TEST_F(UsbTest, eventLoopHandlesEventsUntilDestroyed)
+    {
+        std::promise<void> handled;
+        EXPECT_CALL(*usbmock, handle_events_timeout_completed(&session, NotNull(), nullptr))
+            .WillOnce(DoAll(InvokeWithoutArgs([&handled] { handled.set_value(); }), Return(LIBUSB_SUCCESS)))
+            .WillRepeatedly(DoAll(InvokeWithoutArgs([] { std::this_thread::sleep_for(std::chrono::milliseconds{1}); }), Return(LIBUSB_SUCCESS)));
+        EXPECT_CALL(*usbmock, interrupt_event_handler(&session));
+
+        EventLoop events{context};
+        handled.get_future().wait();
+    }
+
+    TEST_F(UsbTest, hasHotplugReturnsCapability)
+    {
+        EXPECT_CALL(*usbmock, has_capability(LIBUSB_CAP_HAS_HOTPLUG)).WillOnce(Return(1));
+        EXPECT_THAT(hasHotplug(), IsTrue());
+    }
+
+    TEST_F(UsbTest, hotplugRegistersCallbackPerProduct)
+    {
+        EXPECT_CALL(*usbmock, handle_events_timeout_completed(_, _, _)).WillRepeatedly(Return(LIBUSB_SUCCESS));
+        EXPECT_CALL(*usbmock, interrupt_event_handler(&session));
+
+        InSequence s;
+        EXPECT_CALL(*usbmock, hotplug_register_callback(&session, LIBUSB_HOTPLUG_EVENT_DEVICE_ARRIVED | LIBUSB_HOTPLUG_EVENT_DEVICE_LEFT,
+                                                        LIBUSB_HOTPLUG_ENUMERATE, 0x1ed8, 0x0005, LIBUSB_HOTPLUG_MATCH_ANY, NotNull(), NotNull(), NotNull()))
+            .WillOnce(DoAll(SetArgPointee<8>(1), Return(LIBUSB_SUCCESS)));
+        EXPECT_CALL(*usbmock, hotplug_register_callback(&session, _, _, 0x1ed8, 0x0014, _, _, _, _))
+            .WillOnce(DoAll(SetArgPointee<8>(2), Return(LIBUSB_SUCCESS)));
+        EXPECT_CALL(*usbmock, hotplug_deregister_callback(&session, 1));
+        EXPECT_CALL(*usbmock, hotplug_deregister_callback(&session, 2));
+
+        Hotplug hotplug{context, 0x1ed8, {0x0005, 0x0014}, [](Hotplug::Event, Device) {}};
+    }
+
+    TEST_F(UsbTest, hotplugThrowsAndDeregistersOnRegisterError)
+    {
+        EXPECT_CALL(*usbmock, handle_events_timeout_completed(_, _, _)).WillRepeatedly(Return(LIBUSB_SUCCESS));
+        EXPECT_CALL(*usbmock, interrupt_event_handler(&session));
+        EXPECT_CALL(*usbmock, error_name(_)).WillRepeatedly(Return("LIBUSB_ERROR_NOT_SUPPORTED"));
+        EXPECT_CALL(*usbmock, strerror(_)).WillRepeatedly(Return("not supported"));
+
+        InSequence s;
+        EXPECT_CALL(*usbmock, hotplug_register_callback(_, _, _, _, 0x0005, _, _, _, _))
+            .WillOnce(DoAll(SetArgPointee<8>(1), Return(LIBUSB_SUCCESS)));
+        EXPECT_CALL(*usbmock, hotplug_register_callback(_, _, _, _, 0x0014, _, _, _, _))
+            .WillOnce(Return(LIBUSB_ERROR_NOT_SUPPORTED));
+        EXPECT_CALL(*usbmock, hotplug_deregister_callback(&session, 1));
+
+        EXPECT_THROW((Hotplug{context, 0x1ed8, {0x0005, 0x0014}, [](Hotplug::Event, Device) {}}), UsbException);
+    }
+
+    TEST_F(UsbTest, hotplugReportsArrivedAndLeftDevices)
+    {
+        libusb_hotplug_callback_fn callback{nullptr};
+        void* userData{nullptr};
+        EXPECT_CALL(*usbmock, handle_events_timeout_completed(_, _, _)).WillRepeatedly(Return(LIBUSB_SUCCESS));
+        EXPECT_CALL(*usbmock, interrupt_event_handler(&session));
+        EXPECT_CALL(*usbmock, hotplug_register_callback(_, _, _, _, _, _, _, _, _))
+            .WillOnce(DoAll(SaveArg<6>(&callback), SaveArg<7>(&userData), SetArgPointee<8>(1), Return(LIBUSB_SUCCESS)));
+        EXPECT_CALL(*usbmock, hotplug_deregister_callback(&session, 1));
+        EXPECT_CALL(*usbmock, ref_device(&dev)).Times(2).WillRepeatedly(Return(&dev));
+        EXPECT_CALL(*usbmock, get_device_descriptor(&dev, _))
+            .Times(2)
+            .WillRepeatedly(DoAll(SetArgPointee<1>(libusb_device_descriptor{18, 1, 0, 0, 0, 0, 0, 0x1ed8, 0x0005, 0, 0, 0, 0, 0}),
+                                  Return(LIBUSB_SUCCESS)));
+        EXPECT_CALL(*usbmock, unref_device(&dev)).Times(2);
+
+        std::vector<std::pair<Hotplug::Event, std::uint16_t>> reported;
+        Hotplug hotplug{context, 0x1ed8, {0x0005}, [&reported](Hotplug::Event event, Device device)
+                        { reported.emplace_back(event, device.productId()); }};
+
+        ASSERT_THAT(callback, NotNull());
+        EXPECT_THAT(callback(&session, &dev, LIBUSB_HOTPLUG_EVENT_DEVICE_ARRIVED, userData), Eq(0));
+        EXPECT_THAT(callback(&session, &dev, LIBUSB_HOTPLUG_EVENT_DEVICE_LEFT, userData), Eq(0));
+        EXPECT_THAT(reported, ElementsAre(Pair(Hotplug::Event::arrived, 0x0005), Pair(Hotplug::Event::left, 0x0005)));
+    }
+
+    TEST_F(UsbTest, hotplugUsesContextForRegistrationEventsAndDevices)
+    {
+        libusb_hotplug_callback_fn callback{nullptr};
+        void* userData{nullptr};
+        EXPECT_CALL(*usbmock, init(_)).WillOnce(DoAll(SetArgPointee<0>(&ctx), Return(LIBUSB_SUCCESS)));
+        EXPECT_CALL(*usbmock, handle_events_timeout_completed(&ctx, _, _)).WillRepeatedly(Return(LIBUSB_SUCCESS));
+        EXPECT_CALL(*usbmock, interrupt_event_handler(&ctx));
+        EXPECT_CALL(*usbmock, hotplug_register_callback(&ctx, _, _, _, _, _, _, _, _))
+            .WillOnce(DoAll(SaveArg<6>(&callback), SaveArg<7>(&userData), SetArgPointee<8>(1), Return(LIBUSB_SUCCESS)));
+        EXPECT_CALL(*usbmock, hotplug_deregister_callback(&ctx, 1));
+        EXPECT_CALL(*usbmock, ref_device(&dev)).WillOnce(Return(&dev));
+        EXPECT_CALL(*usbmock, get_device_descriptor(&dev, _)).WillOnce(DoAll(SetArgPointee<1>(libusb_device_descriptor{}), Return(LIBUSB_SUCCESS)));
+        EXPECT_CALL(*usbmock, unref_device(&dev));
+        EXPECT_CALL(*usbmock, exit(&ctx));
+
+        libusb_context* deviceContext{nullptr};
+        Hotplug hotplug{std::make_shared<Context>(), 0x1ed8, {0x0005}, [&deviceContext](Hotplug::Event, Device device)
+                        { deviceContext = device.context()->get(); }};
+
+        ASSERT_THAT(callback, NotNull());
+        callback(&ctx, &dev, LIBUSB_HOTPLUG_EVENT_DEVICE_ARRIVED, userData);
+        EXPECT_THAT(deviceContext, Eq(&ctx));
+    }
 }
@@ -0,0 +1,480 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "MustangEmulator.h"
+#include "com/CommunicationException.h"
+#include "com/IdLookup.h"
+#include "com/PacketSerializer.h"
+#include <algorithm>
+#include <thread>
+
+namespace plug::test::emulator
+{
+    using namespace plug::com;
+
+    namespace
+    {
+        inline constexpr std::size_t posStage{0};
+        inline constexpr std::size_t posType{1};
+        inline constexpr std::size_t posDsp{2};
+        inline constexpr std::size_t posKnob{3};
+        inline constexpr std::size_t posSlot{4};
+        inline constexpr std::size_t posPayload{16};
+        inline constexpr std::size_t posAmpModel{posPayload};
+
+        inline constexpr std::uint8_t stageInit0{0x00};
+        inline constexpr std::uint8_t stageInit1{0x1a};
+        inline constexpr std::uint8_t stageReady{0x1c};
+        inline constexpr std::uint8_t stageUnknown{0xff};
+        inline constexpr std::uint8_t typeOperation{0x01};
+        inline constexpr std::uint8_t typeData{0x03};
+        inline constexpr std::uint8_t typeInit0{0xc3};
+        inline constexpr std::uint8_t typeLoad{0xc1};
+
+        inline constexpr std::uint8_t dspNone{0x00};
+        inline constexpr std::uint8_t dspSelectBank{0x01};
+        inline constexpr std::uint8_t dspSave{0x03};
+        inline constexpr std::uint8_t dspName{0x04};
+        inline constexpr std::uint8_t dspAmp{0x05};
+        inline constexpr std::uint8_t dspEffect0{0x06};
+        inline constexpr std::uint8_t dspEffect1{0x07};
+        inline constexpr std::uint8_t dspEffect2{0x08};
+        inline constexpr std::uint8_t dspEffect3{0x09};
+        inline constexpr std::uint8_t dspUsbGain{0x0d};
+
+        inline constexpr std::uint8_t knobNone{0x00};
+        inline constexpr std::uint8_t knobMod{0x01};
+        inline constexpr std::uint8_t knobDlyRev{0x02};
+
+        inline constexpr std::size_t fallbackNumberOfPresets{24};
+        inline constexpr std::size_t fallbackNumberOfKnobPresets{4};
+
+
+        constexpr bool isCommand(const PacketRawType& packet, std::uint8_t stage, std::uint8_t type)
+        {
+            return (packet[posStage] == stage) && (packet[posType] == type);
+        }
+
+        PacketRawType streamPacket(std::uint8_t dsp, std::uint8_t knob, std::uint8_t slot)
+        {
+            PacketRawType packet{};
+            packet[posStage] = stageReady;
+            packet[posType] = typeOperation;
+            packet[posDsp] = dsp;
+            packet[posKnob] = knob;
+            packet[posSlot] = slot;
+            return packet;
+        }
+
+        PacketRawType asStreamPacket(PacketRawType packet, std::uint8_t dsp, std::uint8_t knob, std::uint8_t slot)
+        {
+            const auto header = streamPacket(dsp, knob, slot);
+            std::copy_n(header.cbegin(), posPayload, packet.begin());
+            return packet;
+        }
+
+        PacketRawType namePacket(std::string_view name, std::uint8_t knob, std::uint8_t slot)
+        {
+            NamePayload payload{};
+            payload.setName(name);
+            const auto bytes = payload.getBytes();
+
+            auto packet = streamPacket(dspName, knob, slot);
+            std::copy(bytes.cbegin(), bytes.cend(), std::next(packet.begin(), posPayload));
+            return packet;
+        }
+
+        PacketRawType confirmationPacket(std::uint8_t knob, std::uint8_t slot)
+        {
+            return streamPacket(dspNone, knob, slot);
+        }
+
+        std::string nameOf(const PacketRawType& packet)
+        {
+            return fromRawData<NamePayload>(packet).getPayload().getName();
+        }
+
+        std::string defaultName(std::string_view prefix, std::size_t slot)
+        {
+            return std::string{prefix} + " " + std::to_string(slot);
+        }
+
+        amp_settings defaultAmp()
+        {
+            amp_settings amp{};
+            amp.amp_num = amps::FENDER_57_DELUXE;
+            amp.cabinet = cabinets::cab57DLX;
+            amp.gain = 0x80;
+            amp.volume = 0x80;
+            amp.treble = 0x80;
+            amp.middle = 0x80;
+            amp.bass = 0x80;
+            amp.master_vol = 0x80;
+            amp.gain2 = 0x80;
+            amp.presence = 0x80;
+            amp.bias = 0x80;
+            return amp;
+        }
+
+        PacketRawType emptyEffect(std::uint8_t dsp)
+        {
+            auto packet = serializeClearEffectSettings(fx_pedal_settings{FxSlot{0}, effects::EMPTY, 0, 0, 0, 0, 0, 0, false}).getBytes();
+            packet[posDsp] = dsp;
+            return packet;
+        }
+    }
+
+
+    MustangEmulator::MustangEmulator(DeviceModel model, std::chrono::microseconds latency)
+        : model_(model), latency_(latency), open_(true), state_(State::uninitialized),
+          banks_(), current_(), currentSlot_(0), modPresets_(), dlyRevPresets_(), responses_(),
+          outTransfers_(0), inTransfers_(0)
+    {
+        const auto amp = defaultAmp();
+        const Bank bank{"", serializeAmpSettings(amp).getBytes(),
+                        {{emptyEffect(dspEffect0), emptyEffect(dspEffect1), emptyEffect(dspEffect2), emptyEffect(dspEffect3)}},
+                        serializeAmpSettingsUsbGain(amp).getBytes()};
+
+        const std::size_t numberOfPresets = model_.numberOfPresets() > 0 ? model_.numberOfPresets() : fallbackNumberOfPresets;
+        banks_.resize(numberOfPresets, bank);
+
+        for (std::size_t i = 0; i < banks_.size(); ++i)
+        {
+            banks_[i].name = defaultName("Preset", i);
+        }
+        current_ = banks_[0];
+
+        const std::size_t numberOfModPresets = model_.numberOfModPresets() > 0 ? model_.numberOfModPresets() : fallbackNumberOfKnobPresets;
+        const std::size_t numberOfDlyRevPresets = model_.numberOfDlyRevPresets() > 0 ? model_.numberOfDlyRevPresets() : fallbackNumberOfKnobPresets;
+
+        for (std::size_t i = 0; i < numberOfModPresets; ++i)
+        {
+            modPresets_.push_back({defaultName("Mod", i), {emptyEffect(dspEffect1)}});
+        }
+
+        for (std::size_t i = 0; i < numberOfDlyRevPresets; ++i)
+        {
+            dlyRevPresets_.push_back({defaultName("Dly/Rev", i), {emptyEffect(dspEffect2), emptyEffect(dspEffect3)}});
+        }
+    }
+
+    MustangEmulator::MustangEmulator(DeviceModel model)
+        : MustangEmulator(model, std::chrono::microseconds{0})
+    {
+    }
+
+    void MustangEmulator::close()
+    {
+        const std::lock_guard lock{mutex_};
+        open_ = false;
+    }
+
+    bool MustangEmulator::isOpen() const
+    {
+        const std::lock_guard lock{mutex_};
+        return open_;
+    }
+
+    std::vector<std::uint8_t> MustangEmulator::receive(std::size_t recvSize)
+    {
+        std::vector<std::uint8_t> buffer(recvSize);
+        buffer.resize(receiveImpl(buffer.data(), buffer.size()));
+        return buffer;
+    }
+
+    std::string MustangEmulator::name() const
+    {
+        return model_.name();
+    }
+
+    bool MustangEmulator::isInitialized() const
+    {
+        const std::lock_guard lock{mutex_};
+        return state_ == State::ready;
+    }
+
+    std::string MustangEmulator::presetName(std::uint8_t slot) const
+    {
+        const std::lock_guard lock{mutex_};
+        return banks_.at(slot).name;
+    }
+
+    std::string MustangEmulator::knobPresetName(std::uint8_t knob, std::uint8_t slot) const
+    {
+        const std::lock_guard lock{mutex_};
+        return knobPresets(knob).at(slot).name;
+    }
+
+    std::string MustangEmulator::currentName() const
+    {
+        const std::lock_guard lock{mutex_};
+        return current_.name;
+    }
+
+    amp_settings MustangEmulator::currentAmp() const
+    {
+        const std::lock_guard lock{mutex_};
+        return decodeAmpFromData(fromRawData<AmpPayload>(current_.amp), fromRawData<AmpPayload>(current_.usbGain));
+    }
+
+    std::vector<fx_pedal_settings> MustangEmulator::currentEffects() const
+    {
+        const std::lock_guard lock{mutex_};
+        return decodeEffectsFromData({{fromRawData<EffectPayload>(current_.effects[0]), fromRawData<EffectPayload>(current_.effects[1]),
+                                       fromRawData<EffectPayload>(current_.effects[2]), fromRawData<EffectPayload>(current_.effects[3])}});
+    }
+
+    std::size_t MustangEmulator::outTransfers() const
+    {
+        const std::lock_guard lock{mutex_};
+        return outTransfers_;
+    }
+
+    std::size_t MustangEmulator::inTransfers() const
+    {
+        const std::lock_guard lock{mutex_};
+        return inTransfers_;
+    }
+
+    std::size_t MustangEmulator::sendImpl(const std::uint8_t* data, std::size_t size)
+    {
+        delay();
+
+        const std::lock_guard lock{mutex_};
+
+        if (open_ == false)
+        {
+            throw CommunicationException{"Device not connected"};
+        }
+        ++outTransfers_;
+
+        PacketRawType packet{};
+        std::copy_n(data, std::min(size, packet.size()), packet.begin());
+        handle(packet);
+        return size;
+    }
+
+    std::size_t MustangEmulator::receiveImpl(std::uint8_t* data, std::size_t size)
+    {
+        delay();
+
+        const std::lock_guard lock{mutex_};
+
+        if (open_ == false)
+        {
+            throw CommunicationException{"Device not connected"};
+        }
+        ++inTransfers_;
+
+        if (responses_.empty())
+        {
+            return 0;
+        }
+
+        const auto n = std::min(size, responses_.front().size());
+        std::copy_n(responses_.front().cbegin(), n, data);
+        responses_.pop_front();
+        return n;
+    }
+
+    void MustangEmulator::handle(const PacketRawType& packet)
+    {
+        if (isCommand(packet, stageInit0, typeInit0))
+        {
+            state_ = State::initializing;
+            acknowledge(packet);
+        }
+        else if (isCommand(packet, stageInit1, typeLoad) && (state_ != State::uninitialized))
+        {
+            state_ = State::ready;
+            acknowledge(packet);
+        }
+        else if (state_ != State::ready)
+        {
+            // Not initialized amps don't answer
+        }
+        else if (isCommand(packet, stageUnknown, typeLoad))
+        {
+            streamPresets();
+        }
+        else if (isCommand(packet, stageReady, typeData))
+        {
+            handleData(packet);
+            acknowledge(packet);
+        }
+        else if (isCommand(packet, stageReady, typeOperation))
+        {
+            handleOperation(packet);
+        }
+        else
+        {
+            acknowledge(packet);
+        }
+    }
+
+    void MustangEmulator::handleData(const PacketRawType& packet)
+    {
+        const auto dsp = packet[posDsp];
+        const auto knob = packet[posKnob];
+
+        if (knob != knobNone)
+        {
+            auto& presets = knobPresets(knob);
+
+            if ((dsp >= dspEffect1) && (dsp <= dspEffect3) && (packet[posSlot] < presets.size()))
+            {
+                const std::size_t index = ((knob == knobDlyRev) && (dsp == dspEffect3)) ? 1 : 0;
+                presets[packet[posSlot]].effects[index] = packet;
+            }
+            return;
+        }
+
+        switch (dsp)
+        {
+            case dspAmp:
+                if ((model_.category() == DeviceModel::Category::MustangV2) || (isV2Amp(lookupAmpById(packet[posAmpModel])) == false))
+                {
+                    current_.amp = packet;
+                }
+                break;
+            case dspUsbGain:
+                current_.usbGain = packet;
+                break;
+            case dspEffect0:
+            case dspEffect1:
+            case dspEffect2:
+            case dspEffect3:
+                current_.effects[dsp - dspEffect0] = packet;
+                break;
+            default:
+                break;
+        }
+    }
+
+    void MustangEmulator::handleOperation(const PacketRawType& packet)
+    {
+        const auto slot = packet[posSlot];
+
+        switch (packet[posDsp])
+        {
+            case dspSelectBank:
+                if (slot < banks_.size())
+                {
+                    streamBank(slot);
+                }
+                break;
+            case dspSave:
+                if (slot < banks_.size())
+                {
+                    current_.name = nameOf(packet);
+                    banks_[slot] = current_;
+                    currentSlot_ = slot;
+                }
+                acknowledge(packet);
+                break;
+            case dspName:
+                if (auto& presets = knobPresets(packet[posKnob]); slot < presets.size())
+                {
+                    presets[slot].name = nameOf(packet);
+                }
+                acknowledge(packet);
+                break;
+            default:
+                acknowledge(packet);
+                break;
+        }
+    }
+
+    void MustangEmulator::streamPresets()
+    {
+        for (std::size_t i = 0; i < banks_.size(); ++i)
+        {
+            const auto slot = static_cast<std::uint8_t>(i);
+            responses_.push_back(namePacket(banks_[i].name, knobNone, slot));
+            responses_.push_back(confirmationPacket(knobNone, slot));
+        }
+
+        responses_.push_back(namePacket(current_.name, knobNone, currentSlot_));
+        responses_.push_back(asStreamPacket(current_.amp, dspAmp, knobNone, currentSlot_));
+        responses_.push_back(asStreamPacket(current_.effects[0], dspEffect0, knobNone, currentSlot_));
+        responses_.push_back(asStreamPacket(current_.effects[1], dspEffect1, knobNone, currentSlot_));
+        responses_.push_back(asStreamPacket(current_.effects[2], dspEffect2, knobNone, currentSlot_));
+        responses_.push_back(asStreamPacket(current_.effects[3], dspEffect3, knobNone, currentSlot_));
+        responses_.push_back(asStreamPacket(current_.usbGain, usbGainReportDsp, knobNone, currentSlot_));
+        responses_.push_back(confirmationPacket(knobNone, currentSlot_));
+
+        streamKnobPresets(knobMod);
+        streamKnobPresets(knobDlyRev);
+    }
+
+    void MustangEmulator::streamBank(std::uint8_t slot)
+    {
+        current_ = banks_[slot];
+        currentSlot_ = slot;
+
+        responses_.push_back(namePacket(current_.name, knobNone, slot));
+        responses_.push_back(asStreamPacket(current_.amp, dspAmp, knobNone, slot));
+        responses_.push_back(asStreamPacket(current_.effects[0], dspEffect0, knobNone, slot));
+        responses_.push_back(asStreamPacket(current_.effects[1], dspEffect1, knobNone, slot));
+        responses_.push_back(asStreamPacket(current_.effects[2], dspEffect2, knobNone, slot));
+        responses_.push_back(asStreamPacket(current_.effects[3], dspEffect3, knobNone, slot));
+        responses_.push_back(asStreamPacket(current_.usbGain, usbGainReportDsp, knobNone, slot));
+        responses_.push_back(confirmationPacket(knobNone, slot));
+    }
+
+    void MustangEmulator::streamKnobPresets(std::uint8_t knob)
+    {
+        const auto& presets = knobPresets(knob);
+
+        for (std::size_t i = 0; i < presets.size(); ++i)
+        {
+            const auto slot = static_cast<std::uint8_t>(i);
+            responses_.push_back(namePacket(presets[i].name, knob, slot));
+            std::transform(presets[i].effects.cbegin(), presets[i].effects.cend(), std::back_inserter(responses_), [knob, slot](const auto& p)
+                           { return asStreamPacket(p, p[posDsp], knob, slot); });
+            responses_.push_back(confirmationPacket(knob, slot));
+        }
+    }
+
+    void MustangEmulator::acknowledge(const PacketRawType& packet)
+    {
+        PacketRawType ack{};
+        ack[posStage] = packet[posStage];
+        ack[posType] = packet[posType];
+        responses_.push_back(ack);
+    }
+
+    std::vector<MustangEmulator::KnobPreset>& MustangEmulator::knobPresets(std::uint8_t knob)
+    {
+        return knob == knobMod ? modPresets_ : dlyRevPresets_;
+    }
+
+    const std::vector<MustangEmulator::KnobPreset>& MustangEmulator::knobPresets(std::uint8_t knob) const
+    {
+        return knob == knobMod ? modPresets_ : dlyRevPresets_;
+    }
+
+    void MustangEmulator::delay() const
+    {
+        if (latency_.count() > 0)
+        {
+            std::this_thread::sleep_for(latency_);
+        }
+    }
+}
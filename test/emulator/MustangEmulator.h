@@ -0,0 +1,113 @@
+/*
+ * PLUG - software to operate Fender Mustang amplifier
+ *        Linux replacement for Fender FUSE software
+ *
+ * Copyright (C) 2017-2024  offa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "DeviceModel.h"
+#include "data_structs.h"
+#include "com/Connection.h"
+#include "com/Packet.h"
+#include <array>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace plug::test::emulator
+{
+    // Software model of a Mustang amplifier on the USB protocol level. It answers
+    // the init and load commands, applies amp, effect, save and bank selection
+    // commands to its internal state and delays every transfer by a fixed latency.
+    class MustangEmulator : public plug::com::Connection
+    {
+    public:
+        MustangEmulator(DeviceModel model, std::chrono::microseconds latency);
+        explicit MustangEmulator(DeviceModel model);
+
+        void close() override;
+        bool isOpen() const override;
+
+        using Connection::receive;
+        std::vector<std::uint8_t> receive(std::size_t recvSize) override;
+
+        std::string name() const override;
+
+        bool isInitialized() const;
+        std::string presetName(std::uint8_t slot) const;
+        std::string knobPresetName(std::uint8_t knob, std::uint8_t slot) const;
+        std::string currentName() const;
+        amp_settings currentAmp() const;
+        std::vector<fx_pedal_settings> currentEffects() const;
+
+        std::size_t outTransfers() const;
+        std::size_t inTransfers() const;
+
+
+    private:
+        enum class State
+        {
+            uninitialized,
+            initializing,
+            ready
+        };
+
+        struct Bank
+        {
+            std::string name;
+            com::PacketRawType amp;
+            std::array<com::PacketRawType, 4> effects;
+            com::PacketRawType usbGain;
+        };
+
+        struct KnobPreset
+        {
+            std::string name;
+            std::vector<com::PacketRawType> effects;
+        };
+
+        std::size_t sendImpl(const std::uint8_t* data, std::size_t size) override;
+        std::size_t receiveImpl(std::uint8_t* data, std::size_t size) override;
+
+        void handle(const com::PacketRawType& packet);
+        void handleData(const com::PacketRawType& packet);
+        void handleOperation(const com::PacketRawType& packet);
+        void streamPresets();
+        void streamBank(std::uint8_t slot);
+        void streamKnobPresets(std::uint8_t knob);
+        void acknowledge(const com::PacketRawType& packet);
+        std::vector<KnobPreset>& knobPresets(std::uint8_t knob);
+        const std::vector<KnobPreset>& knobPresets(std::uint8_t knob) const;
+        void delay() const;
+
+        const DeviceModel model_;
+        const std::chrono::microseconds latency_;
+        mutable std::mutex mutex_;
+        bool open_;
+        State state_;
+        std::vector<Bank> banks_;
+        Bank current_;
+        std::uint8_t currentSlot_;
+        std::vector<KnobPreset> modPresets_;
+        std::vector<KnobPreset> dlyRevPresets_;
+        std::deque<com::PacketRawType> responses_;
+        std::size_t outTransfers_;
+        std::size_t inTransfers_;
+    };
+}
@@ -48,6 +48,17 @@ namespace plug::test::mock
         MOCK_METHOD(void, unref_device, (libusb_device*) );
         MOCK_METHOD(int, open, (libusb_device*, libusb_device_handle**) );
         MOCK_METHOD(int, get_string_descriptor_ascii, (libusb_device_handle*, uint8_t, unsigned char*, int) );
+        MOCK_METHOD(uint8_t, get_bus_number, (libusb_device*) );
+        MOCK_METHOD(int, get_port_numbers, (libusb_device*, uint8_t*, int) );
+        MOCK_METHOD(libusb_transfer*, alloc_transfer, (int) );
+        MOCK_METHOD(void, free_transfer, (libusb_transfer*) );
+        MOCK_METHOD(int, submit_transfer, (libusb_transfer*) );
+        MOCK_METHOD(int, cancel_transfer, (libusb_transfer*) );
+        MOCK_METHOD(int, handle_events_timeout_completed, (libusb_context*, timeval*, int*) );
+        MOCK_METHOD(void, interrupt_event_handler, (libusb_context*) );
+        MOCK_METHOD(int, has_capability, (uint32_t) );
+        MOCK_METHOD(int, hotplug_register_callback, (libusb_context*, int, int, int, int, int, libusb_hotplug_callback_fn, void*, libusb_hotplug_callback_handle*) );
+        MOCK_METHOD(void, hotplug_deregister_callback, (libusb_context*, libusb_hotplug_callback_handle) );
     };
 
     UsbMock* getUsbMock();
@@ -58,6 +69,12 @@ namespace plug::test::mock
 
 extern "C"
 {
+    struct libusb_context
+    {
+        char dummy;
+    };
+
+
     struct libusb_device
     {
         uint16_t idVendor;
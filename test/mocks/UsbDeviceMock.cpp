@@ -82,17 +82,69 @@ namespace plug::com::usb
         }
     }
 
-    std::vector<Device> listDevices()
+    Context::Context()
+        : context_(nullptr)
+    {
+    }
+
+    Context::~Context()
+    {
+    }
+
+    libusb_context* Context::get() const noexcept
+    {
+        return context_;
+    }
+
+
+    std::vector<Device> listDevices([[maybe_unused]] std::shared_ptr<Context> context)
     {
         return plug::test::mock::usbContextMock->listDevices();
     }
 
+    bool hasHotplug()
+    {
+        return plug::test::mock::usbContextMock->hasHotplug();
+    }
+
+
+    Hotplug::Hotplug(std::shared_ptr<Context> context, std::uint16_t vendorId, const std::vector<std::uint16_t>& productIds, Handler handler)
+        : context_(std::move(context)), handler_(std::move(handler)), dispatch_(), handles_(), events_(context_)
+    {
+        plug::test::mock::usbContextMock->registerHotplug(vendorId, productIds);
+    }
+
+    Hotplug::~Hotplug()
+    {
+        deregister();
+    }
+
+    void Hotplug::deregister()
+    {
+        plug::test::mock::usbContextMock->deregisterHotplug();
+    }
+
+
+    EventLoop::EventLoop(std::shared_ptr<Context> context)
+        : context_(std::move(context)), running_(false), thread_()
+    {
+    }
+
+    EventLoop::~EventLoop()
+    {
+    }
+
 
-    Device::Device(libusb_device* device)
-        : device_(device), handle_(nullptr), descriptor_({})
+    Device::Device(libusb_device* device, std::shared_ptr<Context> context)
+        : context_(std::move(context)), device_(device), handle_(nullptr), descriptor_({})
     {
     }
 
+    std::shared_ptr<Context> Device::context() const
+    {
+        return context_;
+    }
+
     void Device::open()
     {
         plug::test::mock::usbDeviceMock->open();
@@ -123,7 +175,12 @@ namespace plug::com::usb
         return plug::test::mock::usbDeviceMock->name();
     }
 
-    std::size_t Device::write(std::uint8_t endpoint, std::uint8_t* data, std::size_t dataSize)
+    std::string Device::location() const
+    {
+        return plug::test::mock::usbDeviceMock->location();
+    }
+
+    std::size_t Device::write(std::uint8_t endpoint, const std::uint8_t* data, std::size_t dataSize)
     {
         return plug::test::mock::usbDeviceMock->write(endpoint, data, dataSize);
     }
@@ -133,4 +190,24 @@ namespace plug::com::usb
         return plug::test::mock::usbDeviceMock->receive(endpoint, dataSize);
     }
 
+    std::size_t Device::receive(std::uint8_t endpoint, std::uint8_t* data, std::size_t dataSize)
+    {
+        return plug::test::mock::usbDeviceMock->receive(endpoint, data, dataSize);
+    }
+
+    std::future<std::size_t> Device::writeAsync(std::uint8_t endpoint, const std::uint8_t* data, std::size_t dataSize)
+    {
+        return plug::test::mock::usbDeviceMock->writeAsync(endpoint, data, dataSize);
+    }
+
+    std::future<std::vector<std::uint8_t>> Device::receiveAsync(std::uint8_t endpoint, std::size_t dataSize)
+    {
+        return plug::test::mock::usbDeviceMock->receiveAsync(endpoint, dataSize);
+    }
+
+    std::future<std::size_t> Device::receiveAsync(std::uint8_t endpoint, std::uint8_t* data, std::size_t dataSize)
+    {
+        return plug::test::mock::usbDeviceMock->receiveAsync(endpoint, data, dataSize);
+    }
+
 }
@@ -29,6 +29,9 @@ namespace plug::test::mock
     struct UsbContextMock
     {
         MOCK_METHOD(std::vector<plug::com::usb::Device>, listDevices, ());
+        MOCK_METHOD(bool, hasHotplug, ());
+        MOCK_METHOD(void, registerHotplug, (std::uint16_t, const std::vector<std::uint16_t>&));
+        MOCK_METHOD(void, deregisterHotplug, ());
     };
 
     UsbContextMock* resetUsbContextMock();
@@ -43,9 +46,14 @@ namespace plug::test::mock
         MOCK_METHOD(bool, isOpen, (), (const, noexcept));
         MOCK_METHOD(std::uint16_t, vendorId, (), (const noexcept));
         MOCK_METHOD(std::uint16_t, productId, (), (const noexcept));
-        MOCK_METHOD(std::size_t, write, (std::uint8_t, std::uint8_t*, std::size_t));
+        MOCK_METHOD(std::size_t, write, (std::uint8_t, const std::uint8_t*, std::size_t));
         MOCK_METHOD(std::vector<std::uint8_t>, receive, (std::uint8_t, std::size_t));
+        MOCK_METHOD(std::size_t, receive, (std::uint8_t, std::uint8_t*, std::size_t));
+        MOCK_METHOD(std::future<std::size_t>, writeAsync, (std::uint8_t, const std::uint8_t*, std::size_t));
+        MOCK_METHOD(std::future<std::vector<std::uint8_t>>, receiveAsync, (std::uint8_t, std::size_t));
+        MOCK_METHOD(std::future<std::size_t>, receiveAsync, (std::uint8_t, std::uint8_t*, std::size_t));
         MOCK_METHOD(std::string, name, ());
+        MOCK_METHOD(std::string, location, ());
     };
 
 